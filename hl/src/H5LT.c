@@ -852,8 +852,16 @@ H5LTopen_file_image(void *buf_ptr, size_t buf_size, unsigned flags)
     if (H5Pset_fapl_core(fapl, alloc_incr, FALSE) < 0)
         goto out;
 
+    /* A read-only image that the application keeps ownership of can be used
+     * in place by the core file driver, without any callbacks
+     */
+    if ((flags & H5LT_FILE_IMAGE_DONT_COPY) && (flags & H5LT_FILE_IMAGE_DONT_RELEASE) &&
+        !(flags & H5LT_FILE_IMAGE_OPEN_RW)) {
+        if (H5Pset_core_image(fapl, buf_ptr, buf_size) < 0)
+            goto out;
+    } /* end if */
     /* Set callbacks for file image ops ONLY if the file image is NOT copied */
-    if (flags & H5LT_FILE_IMAGE_DONT_COPY) {
+    else if (flags & H5LT_FILE_IMAGE_DONT_COPY) {
         H5LT_file_image_ud_t *udata; /* Pointer to udata structure */
 
         /* Allocate buffer to communicate user data to callbacks */
@@ -883,8 +891,10 @@ H5LTopen_file_image(void *buf_ptr, size_t buf_size, unsigned flags)
     }     /* end if */
 
     /* Assign file image in user buffer to FAPL */
-    if (H5Pset_file_image(fapl, buf_ptr, buf_size) < 0)
-        goto out;
+    if (!(flags & H5LT_FILE_IMAGE_DONT_COPY) || !(flags & H5LT_FILE_IMAGE_DONT_RELEASE) ||
+        (flags & H5LT_FILE_IMAGE_OPEN_RW))
+        if (H5Pset_file_image(fapl, buf_ptr, buf_size) < 0)
+            goto out;
 
     /* set file open flags */
     if (flags & H5LT_FILE_IMAGE_OPEN_RW)
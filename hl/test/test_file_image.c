@@ -222,6 +222,22 @@ test_file_image(size_t open_images, size_t nflags, unsigned *flags)
             else
                 VERIFY(*core_buf_ptr_ptr != buf_ptr[i], "vfd buffer and user buffer should be different");
 
+            /* read-only images the application keeps are used in place, so
+             * snapshots of them share the user buffer too
+             */
+            if ((input_flags[i] & H5LT_FILE_IMAGE_DONT_COPY) &&
+                (input_flags[i] & H5LT_FILE_IMAGE_DONT_RELEASE) &&
+                !(input_flags[i] & H5LT_FILE_IMAGE_OPEN_RW)) {
+                const void *snap_ptr = NULL;
+                void *      snap     = NULL;
+
+                if (H5Fget_file_image_snapshot(file_id[i], &snap_ptr, &snap) != buf_size[i])
+                    FAIL_PUTS_ERROR("H5Fget_file_image_snapshot() failed");
+                VERIFY(snap_ptr == buf_ptr[i], "snapshot and user buffer should have been the same");
+                if (H5Frelease_file_image_snapshot(snap) < 0)
+                    FAIL_PUTS_ERROR("H5Frelease_file_image_snapshot() failed");
+            } /* end if */
+
             /*
              *  When the vfd and user buffers are different and H5LT_FILE_IMAGE_OPEN_RW is enabled,
              *  status_flags in the superblock needs to be cleared in the vfd buffer for
@@ -186,6 +186,73 @@ H5AC__set_write_done_callback(H5C_t *cache_ptr, H5AC_write_done_cb_t write_done)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5AC__set_write_done_callback() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_sync_point_stats
+ *
+ * Purpose:     Retrieve the statistics about the sync points run by the
+ *              metadata cache of a file, for this process.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_sync_point_stats(const H5F_t *f, H5F_sync_point_stats_t *stats)
+{
+    H5AC_aux_t *aux_ptr;
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+    HDassert(stats);
+
+    if (NULL == (aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(f->shared->cache)))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "metadata cache does not run sync points")
+    HDassert(aux_ptr->magic == H5AC__H5AC_AUX_T_MAGIC);
+
+    *stats = aux_ptr->sync_point_stats;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_sync_point_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_reset_sync_point_stats
+ *
+ * Purpose:     Reset the statistics about the sync points run by the
+ *              metadata cache of a file, for this process.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_reset_sync_point_stats(const H5F_t *f)
+{
+    H5AC_aux_t *aux_ptr;
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+
+    if (NULL == (aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(f->shared->cache)))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "metadata cache does not run sync points")
+    HDassert(aux_ptr->magic == H5AC__H5AC_AUX_T_MAGIC);
+
+    HDmemset(&aux_ptr->sync_point_stats, 0, sizeof(aux_ptr->sync_point_stats));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_reset_sync_point_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5AC_add_candidate()
  *
@@ -1255,7 +1322,7 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, cache_ptr, num_candidates, candidates_list_ptr,
-                                          aux_ptr->mpi_rank, aux_ptr->mpi_size);
+                                          aux_ptr->mpi_rank, aux_ptr->mpi_size, &aux_ptr->sync_point_stats);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -1679,7 +1746,7 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, cache_ptr, num_entries, haddr_buf_ptr, aux_ptr->mpi_rank,
-                                          aux_ptr->mpi_size);
+                                          aux_ptr->mpi_size, &aux_ptr->sync_point_stats);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -2080,6 +2147,7 @@ H5AC__run_sync_point(H5F_t *f, int sync_point_op)
 {
     H5AC_t *    cache_ptr;
     H5AC_aux_t *aux_ptr;
+    double      start_time;          /* Start of the sync point */
     herr_t      ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2106,6 +2174,12 @@ H5AC__run_sync_point(H5F_t *f, int sync_point_op)
               aux_ptr->rename_dirty_bytes_updates);
 #endif /* H5AC_DEBUG_DIRTY_BYTES_CREATION */
 
+    /* Reset the statistics for this sync point */
+    start_time                             = MPI_Wtime();
+    aux_ptr->sync_point_stats.last_entries = 0;
+    aux_ptr->sync_point_stats.last_blocks  = 0;
+    aux_ptr->sync_point_stats.last_bytes   = 0;
+
     /* clear collective access flag on half of the entries in the
        cache and mark them as independent in case they need to be
        evicted later. All ranks are guaranteed to mark the same entries
@@ -2161,6 +2235,12 @@ H5AC__run_sync_point(H5F_t *f, int sync_point_op)
     /* reset the dirty bytes count */
     aux_ptr->dirty_bytes = 0;
 
+    /* Update the sync point statistics */
+    aux_ptr->sync_point_stats.num_sync_points++;
+    aux_ptr->sync_point_stats.last_time = MPI_Wtime() - start_time;
+    aux_ptr->sync_point_stats.total_time += aux_ptr->sync_point_stats.last_time;
+    aux_ptr->sync_point_stats.total_bytes += aux_ptr->sync_point_stats.last_bytes;
+
 #if H5AC_DEBUG_DIRTY_BYTES_CREATION
     aux_ptr->dirty_bytes_propagations += 1;
     aux_ptr->unprotect_dirty_bytes         = 0;
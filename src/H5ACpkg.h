@@ -400,6 +400,8 @@ typedef struct H5AC_aux_t {
 
     unsigned p0_image_len;
 
+    H5F_sync_point_stats_t sync_point_stats;
+
 } H5AC_aux_t; /* struct H5AC_aux_t */
 
 /* Typedefs for debugging function pointers */
@@ -443,6 +443,8 @@ H5_DLL herr_t              H5AC_proxy_entry_dest(H5AC_proxy_entry_t *pentry);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5AC_add_candidate(H5AC_t *cache_ptr, haddr_t addr);
+H5_DLL herr_t H5AC_get_sync_point_stats(const H5F_t *f, H5F_sync_point_stats_t *stats);
+H5_DLL herr_t H5AC_reset_sync_point_stats(const H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Debugging functions */
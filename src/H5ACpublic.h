@@ -560,6 +560,11 @@ typedef struct H5AC_cache_image_config_t {
     int     entry_ageout;
 } H5AC_cache_image_config_t;
 
+/* Maximum number of entries in a metadata cache prefetch profile
+ * (see H5Pset_mdc_prefetch_profile())
+ */
+#define H5AC__MAX_PREFETCH_PROFILE_ENTRIES 2048
+
 #ifdef __cplusplus
 }
 #endif
@@ -518,6 +518,16 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->image_entries        = NULL;
     cache_ptr->image_buffer         = NULL;
 
+    cache_ptr->pf_max_entries = 0;
+    cache_ptr->pf_nentries    = 0;
+    cache_ptr->pf_entries     = NULL;
+    cache_ptr->pf_load        = FALSE;
+    cache_ptr->pf_delete      = FALSE;
+    cache_ptr->pf_nruns       = 0;
+    cache_ptr->pf_runs        = NULL;
+    cache_ptr->pf_reads       = 0;
+    cache_ptr->pf_hits        = 0;
+
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled = FALSE;
     cache_ptr->mdfsm_settled = FALSE;
@@ -761,6 +771,12 @@ H5C_prep_for_file_close(H5F_t *f)
     /* Make certain there aren't any protected entries */
     HDassert(cache_ptr->pl_len == 0);
 
+    /* Store the prefetch profile, before the cache image (if any) settles
+     * the free space managers.
+     */
+    if (H5C__prep_prefetch_profile_for_file_close(f) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't store prefetch profile")
+
     /* Prepare cache image */
     if (H5C__prep_image_for_file_close(f, &image_generated) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create cache image")
@@ -904,6 +920,9 @@ H5C_dest(H5F_t *f)
         H5MM_xfree(cache_ptr->log_info);
     }
 
+    /* Release the prefetch profile and any prefetched metadata */
+    H5C__free_prefetch_profile(cache_ptr);
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
 
@@ -2260,6 +2279,11 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
             HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't load cache image")
     } /* end if */
 
+    /* Prefetch the entries in the prefetch profile, if requested */
+    if (cache_ptr->pf_load || cache_ptr->pf_delete)
+        if (H5C__load_prefetch_profile(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't load prefetch profile")
+
     read_only  = ((flags & H5C__READ_ONLY_FLAG) != 0);
     flush_last = ((flags & H5C__FLUSH_LAST_FLAG) != 0);
 
@@ -2387,6 +2411,10 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
         entry_ptr = (H5C_cache_entry_t *)thing;
         cache_ptr->entries_loaded_counter++;
 
+        /* Record the entry in the prefetch profile, if recording */
+        if (cache_ptr->pf_max_entries > 0)
+            H5C__record_prefetch_entry(cache_ptr, entry_ptr);
+
         entry_ptr->ring = ring;
 #ifdef H5_HAVE_PARALLEL
         if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && entry_ptr->coll_access)
@@ -7209,8 +7237,10 @@ H5C__load_entry(H5F_t *f,
 #ifdef H5_HAVE_PARALLEL
             if (!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
-                if (H5F_block_read(f, type->mem_type, addr, len, image) < 0)
-                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
+                if (!(f->shared->cache->pf_nruns > 0 &&
+                      H5C__prefetch_profile_read(f->shared->cache, addr, len, image)))
+                    if (H5F_block_read(f, type->mem_type, addr, len, image) < 0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
 #ifdef H5_HAVE_PARALLEL
             } /* end if */
             /* if the collective metadata read optimization is turned on,
@@ -7256,9 +7286,12 @@ H5C__load_entry(H5F_t *f,
                             /* If the thing's image needs to be bigger for a speculatively
                              * loaded thing, go get the on-disk image again (the extra portion).
                              */
-                            if (H5F_block_read(f, type->mem_type, addr + len, actual_len - len, image + len) <
-                                0)
-                                HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image")
+                            if (!(f->shared->cache->pf_nruns > 0 &&
+                                  H5C__prefetch_profile_read(f->shared->cache, addr + len, actual_len - len,
+                                                             image + len)))
+                                if (H5F_block_read(f, type->mem_type, addr + len, actual_len - len,
+                                                   image + len) < 0)
+                                    HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image")
 #ifdef H5_HAVE_PARALLEL
                         }
                         /* If the collective metadata read optimization is turned on,
@@ -241,6 +241,10 @@ typedef struct H5CX_t {
     hbool_t  mpio_chunk_opt_num_valid;   /* Whether collective chunk threshold is valid */
     unsigned mpio_chunk_opt_ratio;       /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
     hbool_t  mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
+    unsigned mpio_aggr_num;              /* # of two-phase I/O aggregators (H5D_XFER_MPIO_AGGR_NUM_NAME) */
+    hbool_t  mpio_aggr_num_valid;        /* Whether # of two-phase I/O aggregators is valid */
+    hsize_t  mpio_aggr_align;            /* Two-phase I/O alignment (H5D_XFER_MPIO_AGGR_ALIGN_NAME) */
+    hbool_t  mpio_aggr_align_valid;      /* Whether two-phase I/O alignment is valid */
 #endif                                   /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;    /* Error detection info (H5D_XFER_EDC_NAME) */
     hbool_t               err_detect_valid;     /* Whether error detection info is valid */
@@ -373,6 +377,8 @@ typedef struct H5CX_dxpl_cache_t {
              mpio_chunk_opt_mode;         /* Collective chunk option (H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME) */
     unsigned mpio_chunk_opt_num;          /* Collective chunk thrreshold (H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME) */
     unsigned mpio_chunk_opt_ratio;        /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
+    unsigned mpio_aggr_num;               /* # of two-phase I/O aggregators (H5D_XFER_MPIO_AGGR_NUM_NAME) */
+    hsize_t  mpio_aggr_align;             /* Two-phase I/O alignment (H5D_XFER_MPIO_AGGR_ALIGN_NAME) */
 #endif                                    /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;     /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t              filter_cb;      /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
@@ -531,6 +537,10 @@ H5CX__init_package(void)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization threshold")
     if (H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, &H5CX_def_dxpl_cache.mpio_chunk_opt_ratio) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization ratio")
+    if (H5P_get(dx_plist, H5D_XFER_MPIO_AGGR_NUM_NAME, &H5CX_def_dxpl_cache.mpio_aggr_num) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve number of I/O aggregators")
+    if (H5P_get(dx_plist, H5D_XFER_MPIO_AGGR_ALIGN_NAME, &H5CX_def_dxpl_cache.mpio_aggr_align) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve I/O aggregator alignment")
 
     /* Get the local & global reasons for breaking collective I/O values */
     if (H5P_get(dx_plist, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME,
@@ -2300,6 +2310,70 @@ H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_mpio_chunk_opt_ratio() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_mpio_aggr_num
+ *
+ * Purpose:     Retrieves the number of two-phase I/O aggregators for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_mpio_aggr_num(unsigned *mpio_aggr_num)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(mpio_aggr_num);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_AGGR_NUM_NAME, mpio_aggr_num)
+
+    /* Get the value */
+    *mpio_aggr_num = (*head)->ctx.mpio_aggr_num;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_mpio_aggr_num() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_mpio_aggr_align
+ *
+ * Purpose:     Retrieves the file domain alignment for two-phase I/O for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_mpio_aggr_align(hsize_t *mpio_aggr_align)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(mpio_aggr_align);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_AGGR_ALIGN_NAME, mpio_aggr_align)
+
+    /* Get the value */
+    *mpio_aggr_align = (*head)->ctx.mpio_aggr_align;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_mpio_aggr_align() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -114,6 +114,8 @@ H5_DLL herr_t H5CX_get_mpio_global_no_coll_cause(uint32_t *mpio_global_no_coll_c
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_mode(H5FD_mpio_chunk_opt_t *mpio_chunk_opt_mode);
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_num(unsigned *mpio_chunk_opt_num);
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio);
+H5_DLL herr_t H5CX_get_mpio_aggr_num(unsigned *mpio_aggr_num);
+H5_DLL herr_t H5CX_get_mpio_aggr_align(hsize_t *mpio_aggr_align);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5CX_get_err_detect(H5Z_EDC_t *err_detect);
 H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
@@ -55,7 +55,7 @@
 /********************/
 /* Local Prototypes */
 /********************/
-static herr_t H5C__collective_write(H5F_t *f);
+static herr_t H5C__collective_write(H5F_t *f, H5F_sync_point_stats_t *stats);
 static herr_t H5C__flush_candidate_entries(H5F_t *f, unsigned entries_to_flush[H5C_RING_NTYPES],
                                            unsigned entries_to_clear[H5C_RING_NTYPES]);
 static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned entries_to_flush,
@@ -141,6 +141,13 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned
  *              or marking clean the candidate entries as indicated.
  *              If necessary, we scan the pinned list as well.
  *
+ *              The images of the entries flushed by this process, in
+ *              all rings, are not written as they are generated, but
+ *              collected and written with a single collective write
+ *              once all rings have been flushed.  If STATS is not NULL,
+ *              the number of entries, file blocks and bytes written by
+ *              this process are added to its "last_" fields.
+ *
  *              Note that this function will fail if any protected or
  *              clean entries appear on the candidate list.
  *
@@ -162,7 +169,7 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned
  */
 herr_t
 H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, haddr_t *candidates_list_ptr,
-                         int mpi_rank, int mpi_size)
+                         int mpi_rank, int mpi_size, H5F_sync_point_stats_t *stats)
 {
     int                i;
     int                m;
@@ -216,14 +223,16 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
     HDfprintf(stdout, "%s", tbl_buf);
 #endif /* H5C_APPLY_CANDIDATE_LIST__DEBUG */
 
-    if (f->shared->coll_md_write) {
-        /* Sanity check */
-        HDassert(NULL == cache_ptr->coll_write_list);
+    /* Sanity check */
+    HDassert(NULL == cache_ptr->coll_write_list);
 
-        /* Create skip list of entries for collective write */
-        if (NULL == (cache_ptr->coll_write_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for entries")
-    } /* end if */
+    /* Create skip list of entries to write collectively, once all the
+     * rings have been flushed.  (All processes apply the candidate list,
+     * so the write is collective whether or not collective metadata
+     * writes were requested.)
+     */
+    if (NULL == (cache_ptr->coll_write_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for entries")
 
     n = num_candidates / (unsigned)mpi_size;
     if (num_candidates % (unsigned)mpi_size > INT_MAX)
@@ -381,15 +390,9 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
     if (H5C__flush_candidate_entries(f, entries_to_flush, entries_to_clear) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "flush candidates failed")
 
-    /* If we've deferred writing to do it collectively, take care of that now */
-    if (f->shared->coll_md_write) {
-        /* Sanity check */
-        HDassert(cache_ptr->coll_write_list);
-
-        /* Write collective list */
-        if (H5C__collective_write(f) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata collectively")
-    } /* end if */
+    /* Write the entries flushed in all rings collectively */
+    if (H5C__collective_write(f, stats) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata collectively")
 
 done:
     if (candidate_assignment_table != NULL)
@@ -940,6 +943,15 @@ done:
  *
  * Purpose:     Perform a collective write of a list of metadata entries.
  *
+ *              The entries are sorted by address, and entries which are
+ *              adjacent in the file are merged into a single block of
+ *              the MPI file datatype, so that the file view describes as
+ *              few blocks as possible.
+ *
+ *              If STATS is not NULL, the number of entries, file blocks
+ *              and bytes written by this process are added to its
+ *              "last_" fields.
+ *
  * Return:      FAIL if error is detected, SUCCEED otherwise.
  *
  * Programmer:  Mohamad Chaarawi
@@ -948,15 +960,17 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5C__collective_write(H5F_t *f)
+H5C__collective_write(H5F_t *f, H5F_sync_point_stats_t *stats)
 {
     H5AC_t *         cache_ptr;
     H5FD_mpio_xfer_t orig_xfer_mode = H5FD_MPIO_COLLECTIVE;
     void *           base_buf;
     int              count;
-    int *            length_array = NULL;
-    MPI_Aint *       buf_array    = NULL;
-    MPI_Aint *       offset_array = NULL;
+    int              nblocks            = 0;
+    int *            length_array       = NULL;
+    MPI_Aint *       buf_array          = NULL;
+    int *            block_length_array = NULL;
+    MPI_Aint *       offset_array       = NULL;
     MPI_Datatype     btype;
     hbool_t          btype_created = FALSE;
     MPI_Datatype     ftype;
@@ -964,6 +978,7 @@ H5C__collective_write(H5F_t *f)
     int              mpi_code;
     char             unused = 0; /* Unused, except for non-NULL pointer value */
     size_t           buf_count;
+    hsize_t          nbytes    = 0;
     herr_t           ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -996,6 +1011,9 @@ H5C__collective_write(H5F_t *f)
         if (NULL == (buf_array = (MPI_Aint *)H5MM_malloc((size_t)count * sizeof(MPI_Aint))))
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
                         "memory allocation failed for collective buf table length array")
+        if (NULL == (block_length_array = (int *)H5MM_malloc((size_t)count * sizeof(int))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
+                        "memory allocation failed for collective write table block length array")
         if (NULL == (offset_array = (MPI_Aint *)H5MM_malloc((size_t)count * sizeof(MPI_Aint))))
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
                         "memory allocation failed for collective offset table length array")
@@ -1007,10 +1025,13 @@ H5C__collective_write(H5F_t *f)
             HGOTO_ERROR(H5E_CACHE, H5E_NOTFOUND, FAIL, "can't retrieve skip list item")
 
         /* Set up initial array position & buffer base address */
-        length_array[0] = (int)entry_ptr->size;
-        base_buf        = entry_ptr->image_ptr;
-        buf_array[0]    = (MPI_Aint)0;
-        offset_array[0] = (MPI_Aint)entry_ptr->addr;
+        length_array[0]       = (int)entry_ptr->size;
+        base_buf              = entry_ptr->image_ptr;
+        buf_array[0]          = (MPI_Aint)0;
+        block_length_array[0] = (int)entry_ptr->size;
+        offset_array[0]       = (MPI_Aint)entry_ptr->addr;
+        nblocks               = 1;
+        nbytes                = (hsize_t)entry_ptr->size;
 
         node = H5SL_next(node);
         i    = 1;
@@ -1021,7 +1042,19 @@ H5C__collective_write(H5F_t *f)
             /* Set up array position */
             length_array[i] = (int)entry_ptr->size;
             buf_array[i]    = (MPI_Aint)entry_ptr->image_ptr - (MPI_Aint)base_buf;
-            offset_array[i] = (MPI_Aint)entry_ptr->addr;
+
+            /* Merge the entry into the previous file block if they are
+             * adjacent in the file, otherwise start a new block.
+             */
+            if (offset_array[nblocks - 1] + block_length_array[nblocks - 1] == (MPI_Aint)entry_ptr->addr &&
+                (size_t)block_length_array[nblocks - 1] + entry_ptr->size <= (size_t)INT_MAX)
+                block_length_array[nblocks - 1] += (int)entry_ptr->size;
+            else {
+                block_length_array[nblocks] = (int)entry_ptr->size;
+                offset_array[nblocks]       = (MPI_Aint)entry_ptr->addr;
+                nblocks++;
+            } /* end else */
+            nbytes += (hsize_t)entry_ptr->size;
 
             /* Advance to next node & array location */
             node = H5SL_next(node);
@@ -1037,8 +1070,8 @@ H5C__collective_write(H5F_t *f)
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
 
         /* Create file MPI type */
-        if (MPI_SUCCESS !=
-            (mpi_code = MPI_Type_create_hindexed(count, length_array, offset_array, MPI_BYTE, &ftype)))
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(nblocks, block_length_array, offset_array,
+                                                                MPI_BYTE, &ftype)))
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
         ftype_created = TRUE;
         if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&ftype)))
@@ -1067,11 +1100,19 @@ H5C__collective_write(H5F_t *f)
     if (H5F_block_write(f, H5FD_MEM_DEFAULT, (haddr_t)0, buf_count, base_buf) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "unable to write entries collectively")
 
+    /* Update the statistics for the sync point */
+    if (stats) {
+        stats->last_entries += (size_t)count;
+        stats->last_blocks += (size_t)nblocks;
+        stats->last_bytes += nbytes;
+    } /* end if */
+
 done:
     /* Free arrays */
-    length_array = (int *)H5MM_xfree(length_array);
-    buf_array    = (MPI_Aint *)H5MM_xfree(buf_array);
-    offset_array = (MPI_Aint *)H5MM_xfree(offset_array);
+    length_array       = (int *)H5MM_xfree(length_array);
+    buf_array          = (MPI_Aint *)H5MM_xfree(buf_array);
+    block_length_array = (int *)H5MM_xfree(block_length_array);
+    offset_array       = (MPI_Aint *)H5MM_xfree(offset_array);
 
     /* Free MPI Types */
     if (btype_created && MPI_SUCCESS != (mpi_code = MPI_Type_free(&btype)))
@@ -3585,6 +3585,35 @@ typedef struct H5C_tag_info_t {
 } H5C_tag_info_t;
 
 
+/****************************************************************************
+ *
+ * structure H5C_pf_run_t
+ *
+ * Each H5C_pf_run_t struct describes a contiguous range of the file that
+ * has been read to prefetch the entries of a metadata cache prefetch
+ * profile.  Runs never overlap, and only contain data of a single
+ * memory type.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr:   Base address of the run in the file.
+ *
+ * len:    Length of the run in bytes.
+ *
+ * mem_type: Memory type used to read the run.
+ *
+ * buf:    Pointer to the dynamically allocated buffer holding the run,
+ *         or NULL if the run has not been read.
+ *
+ ****************************************************************************/
+typedef struct H5C_pf_run_t {
+    haddr_t addr;               /* Base address of the run */
+    size_t len;                 /* Length of the run */
+    H5FD_mem_t mem_type;        /* Memory type of the run */
+    uint8_t *buf;               /* Buffer holding the run */
+} H5C_pf_run_t;
+
+
 /****************************************************************************
  *
  * structure H5C_t
@@ -4444,6 +4473,49 @@ typedef struct H5C_tag_info_t {
  *        or NULL if that    buffer does not exist.
  *
  *
+ * Fields supporting the metadata cache prefetch profile:
+ *
+ * When enabled on a file opened R/W, the cache records the address,
+ * length, and type of the first pf_max_entries entries loaded from
+ * file, and stores that profile in the superblock extension on file
+ * close.  When a read only file with a profile is opened, the entries
+ * in the profile are sorted by address, coalesced into a small number
+ * of runs, and read with one I/O request per run on the next call to
+ * H5C_protect().  Subsequent entry loads are satisfied from the run
+ * buffers instead of the file when possible.
+ *
+ * pf_max_entries: Maximum number of entries to record in the profile,
+ *        or zero if recording is disabled.
+ *
+ * pf_nentries: Number of entries recorded or awaiting prefetch in
+ *        pf_entries.
+ *
+ * pf_entries: Pointer to a dynamically allocated array of instances of
+ *        H5C_prefetch_entry_t, or NULL if the array does not exist.
+ *        When recording, this holds the profile being built.  When
+ *        a profile has been read from file, this holds its entries
+ *        until they are prefetched.
+ *
+ * pf_load:    Boolean flag indicating that the entries in pf_entries
+ *        should be prefetched on the next call to H5C_protect().
+ *
+ * pf_delete:  Boolean flag indicating that the prefetch profile
+ *        superblock extension message should be removed on the next
+ *        call to H5C_protect().  This flag is set iff the file is
+ *        opened R/W and contains a profile, as the profile may not
+ *        describe the file after it has been modified.
+ *
+ * pf_nruns:   Number of runs in pf_runs.
+ *
+ * pf_runs:    Pointer to a dynamically allocated array of instances of
+ *        H5C_pf_run_t, sorted by address, or NULL if there are no
+ *        prefetched runs.
+ *
+ * pf_reads:   Number of reads issued to prefetch the profile.
+ *
+ * pf_hits:    Number of entry loads satisfied from the prefetched runs.
+ *
+ *
  * Free Space Manager Related fields:
  *
  * The free space managers must be informed when we are about to close
@@ -4952,6 +5024,17 @@ struct H5C_t {
     H5C_image_entry_t *        image_entries;
     void *                      image_buffer;
 
+    /* fields supporting the metadata cache prefetch profile */
+    unsigned                    pf_max_entries;
+    size_t                      pf_nentries;
+    H5C_prefetch_entry_t *      pf_entries;
+    hbool_t                     pf_load;
+    hbool_t                     pf_delete;
+    size_t                      pf_nruns;
+    H5C_pf_run_t *              pf_runs;
+    int64_t                     pf_reads;
+    int64_t                     pf_hits;
+
     /* Free Space Manager Related fields */
     hbool_t             rdfsm_settled;
     hbool_t            mdfsm_settled;
@@ -5072,6 +5155,13 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr,
     unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
+H5_DLL herr_t H5C__load_prefetch_profile(H5F_t *f);
+H5_DLL hbool_t H5C__prefetch_profile_read(H5C_t *cache_ptr, haddr_t addr,
+    size_t len, void *buf);
+H5_DLL herr_t H5C__record_prefetch_entry(H5C_t *cache_ptr,
+    const H5C_cache_entry_t *entry_ptr);
+H5_DLL herr_t H5C__prep_prefetch_profile_for_file_close(H5F_t *f);
+H5_DLL herr_t H5C__free_prefetch_profile(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, size_t  space_needed,
@@ -1838,6 +1838,33 @@ typedef struct H5C_image_entry_t {
     void *     image_ptr;
 } H5C_image_entry_t;
 
+/****************************************************************************
+ *
+ * structure H5C_prefetch_entry_t
+ *
+ * Instances of H5C_prefetch_entry_t are used to record the metadata cache
+ * entries that were loaded from file during the early part of a file open,
+ * so that the resulting access profile can be stored in the file and used
+ * to prefetch the same entries with a few large reads on subsequent opens.
+ *
+ * The fields of H5C_prefetch_entry_t are discussed individually below:
+ *
+ * addr:        Base address of the entry in the file.
+ *
+ * size:        Length of the on disk image of the entry in bytes.
+ *
+ * type_id:     Type ID of the cache client of the entry.  This is used to
+ *              select the memory type of the read when the profile is
+ *              used to prefetch the entry.
+ *
+ ****************************************************************************/
+
+typedef struct H5C_prefetch_entry_t {
+    haddr_t addr;
+    size_t  size;
+    int32_t type_id;
+} H5C_prefetch_entry_t;
+
 /****************************************************************************
  *
  * structure H5C_auto_size_ctl_t
@@ -2256,6 +2283,8 @@ H5_DLL herr_t H5C_image_stats(H5C_t *cache_ptr, hbool_t print_header);
 H5_DLL herr_t H5C_insert_entry(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *thing,
                                unsigned int flags);
 H5_DLL herr_t H5C_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, hsize_t len, hbool_t rw);
+H5_DLL herr_t H5C_load_prefetch_profile_on_next_protect(H5F_t *f, size_t nentries,
+                                                       const H5C_prefetch_entry_t *entries, hbool_t rw);
 H5_DLL herr_t H5C_mark_entry_dirty(void *thing);
 H5_DLL herr_t H5C_mark_entry_clean(void *thing);
 H5_DLL herr_t H5C_mark_entry_unserialized(void *thing);
@@ -2272,6 +2301,7 @@ H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr, H5C_c
 H5_DLL herr_t H5C_set_evictions_enabled(H5C_t *cache_ptr, hbool_t evictions_enabled);
 H5_DLL herr_t H5C_set_slist_enabled(H5C_t *cache_ptr, hbool_t slist_enabled, hbool_t clear_slist);
 H5_DLL herr_t H5C_set_prefix(H5C_t *cache_ptr, char *prefix);
+H5_DLL herr_t H5C_set_prefetch_profile_config(const H5F_t *f, H5C_t *cache_ptr, unsigned max_entries);
 H5_DLL herr_t H5C_stats(H5C_t *cache_ptr, const char *cache_name, hbool_t display_detailed_stats);
 H5_DLL void   H5C_stats__reset(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_unpin_entry(void *thing);
@@ -2300,7 +2330,8 @@ H5_DLL herr_t H5C_get_logging_status(const H5C_t *cache, /*OUT*/ hbool_t *is_ena
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates,
-                                       haddr_t *candidates_list_ptr, int mpi_rank, int mpi_size);
+                                       haddr_t *candidates_list_ptr, int mpi_rank, int mpi_size,
+                                       H5F_sync_point_stats_t *stats);
 H5_DLL herr_t H5C_construct_candidate_list__clean_cache(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_construct_candidate_list__min_clean(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_clear_coll_entries(H5C_t *cache_ptr, hbool_t partial);
@@ -0,0 +1,563 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Cprofile.c
+ *
+ * Purpose:     Functions in this file implement the metadata cache
+ *		prefetch profile: recording the entries loaded after a
+ *		R/W open, storing them in the superblock extension on
+ *		close, and prefetching them with a few large reads when
+ *		the file is next opened read only.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Cmodule.h" /* This source code file is part of the H5C module */
+#define H5F_FRIEND     /*suppress error about including H5Fpkg	  */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Cpkg.h"      /* Cache				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Fpkg.h"      /* Files				*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Oprivate.h"  /* Object headers			*/
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Largest gap between two profile entries that is read through, rather
+ * than starting a new run.
+ */
+#define H5C__PREFETCH_MAX_GAP ((haddr_t)(32 * 1024))
+
+/* Minimum number of bytes prefetched for each entry, so that the initial
+ * speculative read of entries such as object headers is usually satisfied
+ * from the prefetched runs.
+ */
+#define H5C__PREFETCH_MIN_ENTRY_LEN ((haddr_t)512)
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int        H5C__prefetch_entry_cmp(const void *_entry1, const void *_entry2);
+static H5FD_mem_t H5C__prefetch_fs_type(const H5F_t *f, H5FD_mem_t mem_type);
+static hbool_t    H5C__prefetch_profile_usable(const H5F_t *f);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_entry_cmp()
+ *
+ * Purpose:     Comparison callback for qsort(3) on array of
+ *		H5C_prefetch_entry_t, sorting by address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first entry is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__prefetch_entry_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5C_prefetch_entry_t *entry1    = (const H5C_prefetch_entry_t *)_entry1;
+    const H5C_prefetch_entry_t *entry2    = (const H5C_prefetch_entry_t *)_entry2;
+    int                         ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_addr_lt(entry1->addr, entry2->addr))
+        ret_value = -1;
+    else if (H5F_addr_gt(entry1->addr, entry2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_entry_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_fs_type()
+ *
+ * Purpose:     Map a memory type to the file space type it is allocated
+ *		from, so that entries of different types that live in the
+ *		same file can be read together.
+ *
+ * Return:      The file space type for mem_type.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_mem_t
+H5C__prefetch_fs_type(const H5F_t *f, H5FD_mem_t mem_type)
+{
+    H5FD_mem_t ret_value = mem_type;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5FD_MEM_DEFAULT != f->shared->fs_type_map[mem_type])
+        ret_value = f->shared->fs_type_map[mem_type];
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_fs_type() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_profile_usable()
+ *
+ * Purpose:     Determine whether the prefetch profile can be recorded or
+ *		used with the current file access: it is not supported
+ *		with parallel or SWMR access, nor with page buffering,
+ *		which already aggregates metadata reads.
+ *
+ * Return:      TRUE if the profile can be used, FALSE otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5C__prefetch_profile_usable(const H5F_t *f)
+{
+    hbool_t ret_value = TRUE;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) ||
+        (H5F_INTENT(f) & (H5F_ACC_SWMR_READ | H5F_ACC_SWMR_WRITE)) || f->shared->page_buf != NULL)
+        ret_value = FALSE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_profile_usable() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_prefetch_profile_config()
+ *
+ * Purpose:     Enable recording of the first max_entries entries loaded
+ *		into the cache, for storage as a prefetch profile when the
+ *		file is closed.  Recording is only enabled for files opened
+ *		R/W, as the profile can't be stored otherwise.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_prefetch_profile_config(const H5F_t *f, H5C_t *cache_ptr, unsigned max_entries)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(max_entries <= H5AC__MAX_PREFETCH_PROFILE_ENTRIES);
+    HDassert(NULL == cache_ptr->pf_entries);
+
+    if (max_entries > 0 && (H5F_INTENT(f) & H5F_ACC_RDWR) && H5C__prefetch_profile_usable(f)) {
+        if (NULL == (cache_ptr->pf_entries = (H5C_prefetch_entry_t *)H5MM_malloc(
+                         (size_t)max_entries * sizeof(H5C_prefetch_entry_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetch profile")
+        cache_ptr->pf_max_entries = max_entries;
+        cache_ptr->pf_nentries    = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_prefetch_profile_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__record_prefetch_entry()
+ *
+ * Purpose:     Append an entry that was just loaded from file to the
+ *		prefetch profile being recorded, if there is room left.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__record_prefetch_entry(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->type);
+
+    /* The superblock and driver info block are always read before the
+     * profile is, and entries that are never read need no prefetching.
+     */
+    if (cache_ptr->pf_nentries < cache_ptr->pf_max_entries && entry_ptr->type->id != H5AC_SUPERBLOCK_ID &&
+        entry_ptr->type->id != H5AC_DRVRINFO_ID && 0 == (entry_ptr->type->flags & H5C__CLASS_SKIP_READS)) {
+        H5C_prefetch_entry_t *pf_entry = &cache_ptr->pf_entries[cache_ptr->pf_nentries++];
+
+        pf_entry->addr    = entry_ptr->addr;
+        pf_entry->size    = entry_ptr->size;
+        pf_entry->type_id = entry_ptr->type->id;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__record_prefetch_entry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_load_prefetch_profile_on_next_protect()
+ *
+ * Purpose:     Note that a prefetch profile superblock extension message
+ *		exists.  If the file is opened read only, keep a copy of
+ *		the profile so that its entries are prefetched on the next
+ *		call to H5C_protect().  If the file is opened R/W, the
+ *		profile may go stale, so arrange for the message to be
+ *		removed on the next call to H5C_protect() instead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_load_prefetch_profile_on_next_protect(H5F_t *f, size_t nentries, const H5C_prefetch_entry_t *entries,
+                                          hbool_t rw)
+{
+    H5C_t *cache_ptr;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if (rw)
+        cache_ptr->pf_delete = TRUE;
+    else if (nentries > 0 && !cache_ptr->load_image && H5C__prefetch_profile_usable(f)) {
+        HDassert(entries);
+        HDassert(NULL == cache_ptr->pf_entries);
+
+        if (NULL == (cache_ptr->pf_entries =
+                         (H5C_prefetch_entry_t *)H5MM_malloc(nentries * sizeof(H5C_prefetch_entry_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetch profile")
+        H5MM_memcpy(cache_ptr->pf_entries, entries, nentries * sizeof(H5C_prefetch_entry_t));
+        cache_ptr->pf_nentries = nentries;
+        cache_ptr->pf_load     = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_load_prefetch_profile_on_next_protect() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_prefetch_profile()
+ *
+ * Purpose:     Act on a prefetch profile noted by
+ *		H5C_load_prefetch_profile_on_next_protect().
+ *
+ *		If the file is opened R/W, remove the profile message from
+ *		the superblock extension.
+ *
+ *		Otherwise, sort the profile entries by address, and merge
+ *		entries of the same file space type that are at most
+ *		H5C__PREFETCH_MAX_GAP bytes apart into runs.  Then read
+ *		each run with a single I/O request.  Later entry loads are
+ *		satisfied from these runs by H5C__prefetch_profile_read().
+ *
+ *		Both actions are deferred until the superblock has been
+ *		read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_prefetch_profile(H5F_t *f)
+{
+    H5C_t *       cache_ptr;
+    H5C_pf_run_t *runs      = NULL;    /* Array of runs to prefetch */
+    size_t        nruns     = 0;       /* Number of runs            */
+    size_t        u;                   /* Local index variable      */
+    herr_t        ret_value = SUCCEED; /* Return value              */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    /* Wait until the superblock is set up */
+    if (NULL == f->shared->sblock)
+        HGOTO_DONE(SUCCEED)
+
+    /* Remove the (possibly stale) profile from a file opened R/W */
+    if (cache_ptr->pf_delete) {
+        cache_ptr->pf_delete = FALSE;
+        if (H5F__super_ext_remove_msg(f, H5O_MDCP_MSG_ID) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTREMOVE, FAIL,
+                        "can't remove metadata cache prefetch profile message from superblock extension")
+    } /* end if */
+
+    if (cache_ptr->pf_load) {
+        H5C_pf_run_t *run = NULL; /* Run being assembled */
+
+        cache_ptr->pf_load = FALSE;
+        HDassert(cache_ptr->pf_entries);
+        HDassert(cache_ptr->pf_nentries > 0);
+        HDassert(NULL == cache_ptr->pf_runs);
+
+        /* Sort the entries by address, and merge them into runs */
+        HDqsort(cache_ptr->pf_entries, cache_ptr->pf_nentries, sizeof(H5C_prefetch_entry_t),
+                H5C__prefetch_entry_cmp);
+        if (NULL == (runs = (H5C_pf_run_t *)H5MM_malloc(cache_ptr->pf_nentries * sizeof(H5C_pf_run_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetch runs")
+        for (u = 0; u < cache_ptr->pf_nentries; u++) {
+            const H5C_prefetch_entry_t *pf_entry = &cache_ptr->pf_entries[u];
+            const H5C_class_t *         type;
+            H5FD_mem_t                  fs_type;
+            haddr_t                     eoa;
+            haddr_t                     end;
+
+            /* Skip entries that don't describe valid metadata */
+            if (pf_entry->type_id < 0 || pf_entry->type_id > cache_ptr->max_type_id ||
+                NULL == (type = cache_ptr->class_table_ptr[pf_entry->type_id]) ||
+                (type->flags & H5C__CLASS_SKIP_READS) || !H5F_addr_defined(pf_entry->addr) ||
+                pf_entry->size == 0 || pf_entry->size >= H5C_MAX_ENTRY_SIZE)
+                continue;
+
+            /* Clamp the run to the EOA, skipping entries beyond it */
+            if (HADDR_UNDEF == (eoa = H5F_get_eoa(f, type->mem_type)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to get EOA")
+            if (H5F_addr_ge(pf_entry->addr, eoa))
+                continue;
+            end = pf_entry->addr + MAX((haddr_t)pf_entry->size, H5C__PREFETCH_MIN_ENTRY_LEN);
+            if (H5F_addr_gt(end, eoa))
+                end = eoa;
+
+            fs_type = H5C__prefetch_fs_type(f, type->mem_type);
+            if (run && H5C__prefetch_fs_type(f, run->mem_type) == fs_type &&
+                H5F_addr_le(pf_entry->addr, run->addr + run->len + H5C__PREFETCH_MAX_GAP)) {
+                if (H5F_addr_gt(end, run->addr + run->len))
+                    run->len = (size_t)(end - run->addr);
+            } /* end if */
+            else {
+                run           = &runs[nruns++];
+                run->addr     = pf_entry->addr;
+                run->len      = (size_t)(end - pf_entry->addr);
+                run->mem_type = type->mem_type;
+                run->buf      = NULL;
+            } /* end else */
+        }     /* end for */
+
+        /* The profile entries are no longer needed */
+        cache_ptr->pf_entries  = (H5C_prefetch_entry_t *)H5MM_xfree(cache_ptr->pf_entries);
+        cache_ptr->pf_nentries = 0;
+
+        /* Read the runs */
+        for (u = 0; u < nruns; u++) {
+            if (NULL == (runs[u].buf = (uint8_t *)H5MM_malloc(runs[u].len)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetch buffer")
+            if (H5F_block_read(f, runs[u].mem_type, runs[u].addr, runs[u].len, runs[u].buf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't prefetch metadata")
+            cache_ptr->pf_reads++;
+        } /* end for */
+
+        /* Hand the runs over to the cache */
+        cache_ptr->pf_runs  = runs;
+        cache_ptr->pf_nruns = nruns;
+        runs                = NULL;
+    } /* end if */
+
+done:
+    if (runs) {
+        for (u = 0; u < nruns; u++)
+            H5MM_xfree(runs[u].buf);
+        H5MM_xfree(runs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_prefetch_profile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_profile_read()
+ *
+ * Purpose:     Copy len bytes at addr from the prefetched runs into buf,
+ *		if a single run contains them.
+ *
+ *		Since the profile is only prefetched for files opened read
+ *		only without SWMR, the runs can't go stale.
+ *
+ * Return:      TRUE if the read was satisfied from the prefetched runs,
+ *		FALSE if it must be read from the file.
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5C__prefetch_profile_read(H5C_t *cache_ptr, haddr_t addr, size_t len, void *buf)
+{
+    size_t  lo, hi;            /* Bounds of binary search */
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(buf);
+
+    /* Find the last run starting at or before addr */
+    lo = 0;
+    hi = cache_ptr->pf_nruns;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (H5F_addr_le(cache_ptr->pf_runs[mid].addr, addr))
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    if (lo > 0) {
+        const H5C_pf_run_t *run = &cache_ptr->pf_runs[lo - 1];
+
+        if (H5F_addr_le(addr + len, run->addr + run->len)) {
+            H5MM_memcpy(buf, run->buf + (addr - run->addr), len);
+            cache_ptr->pf_hits++;
+            ret_value = TRUE;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_profile_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prep_prefetch_profile_for_file_close()
+ *
+ * Purpose:     Remove a pending stale profile, and store the profile
+ *		recorded since the file was opened in the superblock
+ *		extension.
+ *
+ *		The profile isn't stored when a cache image is requested,
+ *		as the image is a superset of the profile, nor in files
+ *		without superblock extension support.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__prep_prefetch_profile_for_file_close(H5F_t *f)
+{
+    H5C_t *cache_ptr;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    /* Remove a stale profile that wasn't removed yet */
+    if (cache_ptr->pf_delete)
+        if (H5C__load_prefetch_profile(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTREMOVE, FAIL, "can't remove stale prefetch profile")
+
+    if (cache_ptr->pf_max_entries > 0 && cache_ptr->pf_nentries > 0 && (H5F_INTENT(f) & H5F_ACC_RDWR) &&
+        !cache_ptr->image_ctl.generate_image && H5C__prefetch_profile_usable(f) && f->shared->sblock &&
+        f->shared->sblock->super_vers >= HDF5_SUPERBLOCK_VERSION_2) {
+        H5O_mdcp_t mdcp_msg; /* Prefetch profile message */
+        size_t     u, v;     /* Local index variables */
+
+        /* Sort the profile, and drop entries recorded more than once */
+        HDqsort(cache_ptr->pf_entries, cache_ptr->pf_nentries, sizeof(H5C_prefetch_entry_t),
+                H5C__prefetch_entry_cmp);
+        for (u = 1, v = 0; u < cache_ptr->pf_nentries; u++)
+            if (!H5F_addr_eq(cache_ptr->pf_entries[u].addr, cache_ptr->pf_entries[v].addr))
+                cache_ptr->pf_entries[++v] = cache_ptr->pf_entries[u];
+            else if (cache_ptr->pf_entries[u].size > cache_ptr->pf_entries[v].size)
+                cache_ptr->pf_entries[v] = cache_ptr->pf_entries[u];
+        cache_ptr->pf_nentries = v + 1;
+
+        mdcp_msg.nentries = cache_ptr->pf_nentries;
+        mdcp_msg.entries  = cache_ptr->pf_entries;
+        if (H5F__super_ext_write_msg(f, H5O_MDCP_MSG_ID, &mdcp_msg, TRUE,
+                                     H5O_MSG_FLAG_FAIL_IF_UNKNOWN_AND_OPEN_FOR_WRITE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL,
+                        "can't write metadata cache prefetch profile message to superblock extension")
+    } /* end if */
+
+    /* Stop recording */
+    cache_ptr->pf_max_entries = 0;
+    cache_ptr->pf_nentries    = 0;
+    cache_ptr->pf_entries     = (H5C_prefetch_entry_t *)H5MM_xfree(cache_ptr->pf_entries);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prep_prefetch_profile_for_file_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__free_prefetch_profile()
+ *
+ * Purpose:     Release the prefetch profile and prefetched runs.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__free_prefetch_profile(H5C_t *cache_ptr)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(cache_ptr);
+
+    for (u = 0; u < cache_ptr->pf_nruns; u++)
+        H5MM_xfree(cache_ptr->pf_runs[u].buf);
+    cache_ptr->pf_runs  = (H5C_pf_run_t *)H5MM_xfree(cache_ptr->pf_runs);
+    cache_ptr->pf_nruns = 0;
+
+    cache_ptr->pf_entries     = (H5C_prefetch_entry_t *)H5MM_xfree(cache_ptr->pf_entries);
+    cache_ptr->pf_nentries    = 0;
+    cache_ptr->pf_max_entries = 0;
+    cache_ptr->pf_load        = FALSE;
+    cache_ptr->pf_delete      = FALSE;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__free_prefetch_profile() */
@@ -57,6 +57,9 @@ static herr_t H5D__write_api_common(hid_t dset_id, hid_t mem_type_id, hid_t mem_
                                     H5VL_object_t **_vol_obj_ptr);
 static herr_t H5D__set_extent_api_common(hid_t dset_id, const hsize_t size[], void **token_ptr,
                                          H5VL_object_t **_vol_obj_ptr);
+static herr_t H5D__io_multi_api_common(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                                       const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+                                       void *rbuf[], const void *wbuf[]);
 
 /*********************/
 /* Package Variables */
@@ -1019,6 +1022,43 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) multiple datasets from the file into
+ *              application memory buffers.  See H5Dread() for the
+ *              meaning of each element of the argument arrays.
+ *
+ *              With collective MPI-IO transfers, the data for all
+ *              datasets is read with a single collective I/O operation
+ *              when possible.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+              hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count > 0 && !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array cannot be NULL")
+
+    /* Read the data */
+    if (H5D__io_multi_api_common(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                 NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
  *
@@ -1110,6 +1150,99 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__write_api_common() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_multi_api_common
+ *
+ * Purpose:     Common helper routine for multi-dataset read and write
+ *              operations.  Exactly one of RBUF and WBUF is non-NULL,
+ *              indicating whether the datasets are read or written.
+ *
+ *              When all datasets belong to the native VOL connector, they
+ *              are handed to it at once, so it can combine the I/O for
+ *              all of them.  Otherwise, the datasets are read or written
+ *              one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_multi_api_common(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                         const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id, void *rbuf[],
+                         const void *wbuf[])
+{
+    H5VL_object_t **vol_obj   = NULL;    /* Dataset VOL objects */
+    hbool_t         is_native = TRUE;    /* Whether all datasets use the native VOL connector */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array cannot be NULL")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array cannot be NULL")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array cannot be NULL")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array cannot be NULL")
+    if (!rbuf && !wbuf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array cannot be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate array of dataset objects")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (H5_VOL_NATIVE != vol_obj[u]->connector->cls->value)
+            is_native = FALSE;
+    } /* end for */
+
+    if (is_native) {
+        /* Let the native VOL connector perform the I/O for all datasets */
+        if (rbuf) {
+            if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_READ_MULTI, dxpl_id, H5_REQUEST_NULL,
+                                      count, dset_id, mem_type_id, mem_space_id, file_space_id, rbuf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+        } /* end if */
+        else if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_WRITE_MULTI, dxpl_id,
+                                       H5_REQUEST_NULL, count, dset_id, mem_type_id, mem_space_id,
+                                       file_space_id, wbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else
+        /* Read or write the datasets one at a time */
+        for (u = 0; u < count; u++) {
+            if (rbuf) {
+                if (H5VL_dataset_read(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                      rbuf[u], H5_REQUEST_NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            } /* end if */
+            else if (H5VL_dataset_write(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u],
+                                        dxpl_id, wbuf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        } /* end for */
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_multi_api_common() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
  *
@@ -1206,6 +1339,43 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) multiple datasets from application memory
+ *              buffers to the file.  See H5Dwrite() for the meaning of
+ *              each element of the argument arrays.
+ *
+ *              With collective MPI-IO transfers, the data for all
+ *              datasets is written with a single collective I/O operation
+ *              when possible.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+               hid_t file_space_id[], hid_t dxpl_id, const void *buf[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count > 0 && !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array cannot be NULL")
+
+    /* Write the data */
+    if (H5D__io_multi_api_common(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, NULL,
+                                 buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
  *
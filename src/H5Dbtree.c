@@ -517,9 +517,9 @@ done:
  *-------------------------------------------------------------------------
  */
 static H5B_ins_t
-H5D__btree_insert(H5F_t H5_ATTR_NDEBUG_UNUSED *f, haddr_t H5_ATTR_NDEBUG_UNUSED addr, void *_lt_key,
-                  hbool_t *lt_key_changed, void *_md_key, void *_udata, void *_rt_key,
-                  hbool_t H5_ATTR_UNUSED *rt_key_changed, haddr_t *new_node_p /*out*/)
+H5D__btree_insert(H5F_t H5_ATTR_NDEBUG_UNUSED *f, haddr_t addr, void *_lt_key, hbool_t *lt_key_changed,
+                  void *_md_key, void *_udata, void *_rt_key, hbool_t H5_ATTR_UNUSED *rt_key_changed,
+                  haddr_t *new_node_p /*out*/)
 {
     H5D_btree_key_t *lt_key = (H5D_btree_key_t *)_lt_key;
     H5D_btree_key_t *md_key = (H5D_btree_key_t *)_md_key;
@@ -552,9 +552,10 @@ H5D__btree_insert(H5F_t H5_ATTR_NDEBUG_UNUSED *f, haddr_t H5_ATTR_NDEBUG_UNUSED
              lt_key->nbytes > 0) {
         /*
          * Already exists.  If the new size is not the same as the old size
-         * then we should reallocate storage.
+         * then we should reallocate storage.  The chunk may also have been
+         * moved to a new address without changing size.
          */
-        if (lt_key->nbytes != udata->chunk_block.length) {
+        if (lt_key->nbytes != udata->chunk_block.length || !H5F_addr_eq(addr, udata->chunk_block.offset)) {
             /* Set node's address (already re-allocated by main chunk routines) */
             HDassert(H5F_addr_defined(udata->chunk_block.offset));
             *new_node_p = udata->chunk_block.offset;
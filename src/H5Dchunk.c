@@ -210,6 +210,13 @@ typedef struct H5D_chunk_it_ud5_t {
     hsize_t *           dset_dims;    /* Dataset dimensions */
 } H5D_chunk_it_ud5_t;
 
+/* Callback info for iteration to gather chunks to relocate */
+typedef struct H5D_chunk_it_ud6_t {
+    size_t           nrecs;  /* Number of chunk records gathered */
+    size_t           nalloc; /* Number of chunk records allocated */
+    H5D_chunk_rec_t *recs;   /* Chunk records */
+} H5D_chunk_it_ud6_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf; /* Read buffer to initialize */
@@ -279,12 +286,18 @@ static ssize_t H5D__nonexistent_readvv(const H5D_io_info_t *io_info, size_t chun
 /* Format convert cb */
 static int H5D__chunk_format_convert_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 
+/* Relocation routines */
+static int H5D__chunk_relocate_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_relocate_cmp(const void *_rec1, const void *_rec2);
+
 /* Helper routines */
 static herr_t   H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims, const hsize_t *curr_dims,
                                          const hsize_t *max_dims);
 static void *   H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
 static void *   H5D__chunk_mem_xfree(void *chk, const void *pline);
 static void *   H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline);
+static herr_t   H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                                            H5F_block_t *new_chunk, hbool_t *alloc_chunk);
 static herr_t   H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
 static herr_t   H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata);
 static hbool_t  H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata);
@@ -6814,38 +6827,25 @@ done:
 } /* H5D__chunk_is_partial_edge_chunk() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_file_alloc()
+ * Function:    H5D__chunk_file_alloc_check()
  *
- * Purpose:     Chunk allocation:
- *          Create the chunk if it doesn't exist, or reallocate the
- *                chunk if its size changed.
- *          The coding is moved and modified from each index structure.
+ * Purpose:     Check whether a chunk needs to be (re)allocated in the file.
+ *              If the size of an existing filtered chunk changed, its old
+ *              space is released.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Vailin Choi; June 2014
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-                      H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled)
+static herr_t
+H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                            H5F_block_t *new_chunk, hbool_t *alloc_chunk)
 {
-    hbool_t alloc_chunk = FALSE;   /* Whether to allocate chunk */
-    herr_t  ret_value   = SUCCEED; /* Return value         */
+    herr_t ret_value = SUCCEED; /* Return value         */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(idx_info);
-    HDassert(idx_info->f);
-    HDassert(idx_info->pline);
-    HDassert(idx_info->layout);
-    HDassert(idx_info->storage);
-    HDassert(new_chunk);
-    HDassert(need_insert);
-
-    *need_insert = FALSE;
+    *alloc_chunk = FALSE;
 
     /* Check for filters on chunks */
     if (idx_info->pline->nused > 0) {
@@ -6887,7 +6887,7 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
                 if (!(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
                     if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, old_chunk->offset, old_chunk->length) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
-                alloc_chunk = TRUE;
+                *alloc_chunk = TRUE;
             } /* end if */
             else {
                 /* Don't need to reallocate chunk, but send its address back up */
@@ -6897,15 +6897,56 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
         }     /* end if */
         else {
             HDassert(!H5F_addr_defined(new_chunk->offset));
-            alloc_chunk = TRUE;
+            *alloc_chunk = TRUE;
         } /* end else */
     }     /* end if */
     else {
         HDassert(!H5F_addr_defined(new_chunk->offset));
         HDassert(new_chunk->length == idx_info->layout->size);
-        alloc_chunk = TRUE;
+        *alloc_chunk = TRUE;
     } /* end else */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc_check() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc()
+ *
+ * Purpose:     Chunk allocation:
+ *          Create the chunk if it doesn't exist, or reallocate the
+ *                chunk if its size changed.
+ *          The coding is moved and modified from each index structure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Vailin Choi; June 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+                      H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled)
+{
+    hbool_t alloc_chunk = FALSE;   /* Whether to allocate chunk */
+    herr_t  ret_value   = SUCCEED; /* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(new_chunk);
+    HDassert(need_insert);
+
+    *need_insert = FALSE;
+
+    /* Check whether the chunk needs to be allocated */
+    if (H5D__chunk_file_alloc_check(idx_info, old_chunk, new_chunk, &alloc_chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to check chunk allocation")
     /* Actually allocate space for the chunk in the file */
     if (alloc_chunk) {
         switch (idx_info->storage->idx_type) {
@@ -6946,6 +6987,84 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_file_alloc() */
 
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc_batch()
+ *
+ * Purpose:     Create or reallocate a set of filtered chunks, as with
+ *              H5D__chunk_file_alloc(), but with a single file space
+ *              allocation for all chunks that need new space.
+ *
+ *              With paged aggregation or file space alignment, the
+ *              chunks are allocated one at a time instead, so that each
+ *              chunk is placed as H5D__chunk_file_alloc() would.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_file_alloc_batch(const H5D_chk_idx_info_t *idx_info, size_t nchunks,
+                            H5D_chunk_alloc_info_t chunks[])
+{
+    hsize_t total_size = 0;       /* Size of all chunks to allocate */
+    size_t  u;                    /* Local index variable */
+    herr_t  ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(idx_info->pline->nused > 0);
+    HDassert(idx_info->storage->idx_type != H5D_CHUNK_IDX_NONE);
+    HDassert(chunks || 0 == nchunks);
+
+    /* Chunks are allocated one at a time when each must be placed on its own,
+     * for paged aggregation or an alignment set with H5Pset_alignment()
+     */
+    if (H5F_paged_aggr(idx_info->f) || H5F_get_alignment(idx_info->f) > 1) {
+        for (u = 0; u < nchunks; u++)
+            if (H5D__chunk_file_alloc(idx_info, &chunks[u].chunk_current, &chunks[u].new_chunk,
+                                      &chunks[u].need_insert, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Determine which chunks need space, releasing the old space of chunks that changed size */
+    for (u = 0; u < nchunks; u++) {
+        if (H5D__chunk_file_alloc_check(idx_info, &chunks[u].chunk_current, &chunks[u].new_chunk,
+                                        &chunks[u].need_insert) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to check chunk allocation")
+        if (chunks[u].need_insert) {
+            HDassert(chunks[u].new_chunk.length > 0);
+            total_size += chunks[u].new_chunk.length;
+        } /* end if */
+    }     /* end for */
+
+    /* Allocate space for all chunks at once and hand it out in order */
+    if (total_size > 0) {
+        haddr_t addr; /* Address of next chunk */
+
+        if (HADDR_UNDEF == (addr = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, total_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+
+        for (u = 0; u < nchunks; u++)
+            if (chunks[u].need_insert) {
+                chunks[u].new_chunk.offset = addr;
+                addr += chunks[u].new_chunk.length;
+            } /* end if */
+    }         /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc_batch() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_format_convert_cb
  *
@@ -7453,3 +7572,183 @@ H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *offset, unsigned
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__get_chunk_info_by_coord() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_relocate_cb
+ *
+ * Purpose:     Callback routine to gather the records of the chunks in
+ *              the index, for relocating them.
+ *
+ * Return:      Success:    H5_ITER_CONT
+ *              Failure:    H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_relocate_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud6_t *udata     = (H5D_chunk_it_ud6_t *)_udata; /* User data */
+    int                 ret_value = H5_ITER_CONT;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Make room for the record */
+    if (udata->nrecs == udata->nalloc) {
+        size_t           new_nalloc = MAX(64, 2 * udata->nalloc); /* New number of records */
+        H5D_chunk_rec_t *new_recs;                                /* Resized record array */
+
+        if (NULL ==
+            (new_recs = (H5D_chunk_rec_t *)H5MM_realloc(udata->recs, new_nalloc * sizeof(H5D_chunk_rec_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, H5_ITER_ERROR, "can't allocate chunk records")
+        udata->recs   = new_recs;
+        udata->nalloc = new_nalloc;
+    } /* end if */
+
+    H5MM_memcpy(&udata->recs[udata->nrecs++], chunk_rec, sizeof(H5D_chunk_rec_t));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_relocate_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_relocate_cmp
+ *
+ * Purpose:     Compare two chunk records by descending address, for
+ *              qsort()
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_relocate_cmp(const void *_rec1, const void *_rec2)
+{
+    const H5D_chunk_rec_t *rec1 = (const H5D_chunk_rec_t *)_rec1;
+    const H5D_chunk_rec_t *rec2 = (const H5D_chunk_rec_t *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(rec2->chunk_addr, rec1->chunk_addr))
+} /* H5D__chunk_relocate_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_relocate
+ *
+ * Purpose:     Move the chunks of a dataset to free space lower in the
+ *              file, starting with the chunk at the highest address.
+ *
+ *              A chunk is only moved when the file space allocator can
+ *              place it below its current address, and the old space is
+ *              released afterwards, so freed space at the end of the file
+ *              shrinks the file.  Chunks are moved until MAX_BYTES bytes
+ *              have been moved (0 for no limit); the last chunk moved may
+ *              go over the limit.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_relocate(H5D_t *dset, hsize_t max_bytes, hsize_t *nmoved)
+{
+    H5D_rdcc_t *       rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *   ent, *next;                          /* Pointers to current & next cache entries */
+    H5D_chk_idx_info_t idx_info;                            /* Chunked index info */
+    H5D_chunk_it_ud6_t udata;                               /* User data for gathering chunks */
+    H5F_t *            f        = dset->oloc.file;          /* File of the dataset */
+    void *             buf      = NULL;                     /* Buffer for moving a chunk */
+    size_t             buf_size = 0;                        /* Size of the buffer */
+    size_t             u;                                   /* Local index variable */
+    herr_t             ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity checks */
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(nmoved);
+
+    HDmemset(&udata, 0, sizeof(udata));
+
+    /* Chunks without an index are located by their position, so can't move */
+    if (H5D_CHUNK_IDX_NONE == dset->shared->layout.storage.u.chunk.idx_type ||
+        !H5D__chunk_is_space_alloc(&dset->shared->layout.storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Write out and evict the cached chunks, as they hold the current addresses */
+    for (ent = rdcc->head; ent; ent = next) {
+        next = ent->next;
+        if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush raw data chunk")
+    } /* end for */
+    H5D__chunk_cinfo_cache_reset(&rdcc->last);
+
+    /* Compose chunked index info struct */
+    idx_info.f       = f;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Gather the chunks, as the index can't be changed while iterating over it */
+    if ((idx_info.storage->ops->iterate)(&idx_info, H5D__chunk_relocate_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+
+    /* Move the chunks at the highest addresses first */
+    if (udata.nrecs > 1)
+        HDqsort(udata.recs, udata.nrecs, sizeof(H5D_chunk_rec_t), H5D__chunk_relocate_cmp);
+
+    for (u = 0; u < udata.nrecs && (0 == max_bytes || *nmoved < max_bytes); u++) {
+        H5D_chunk_rec_t *rec = &udata.recs[u]; /* Chunk to move */
+        H5D_chunk_ud_t   insert_udata;         /* Chunk information to be inserted */
+        haddr_t          new_addr;             /* New address of chunk */
+
+        /* Allocate space for the chunk, and keep it only when it is lower in the file */
+        if (HADDR_UNDEF == (new_addr = H5MF_alloc(f, H5FD_MEM_DRAW, (hsize_t)rec->nbytes)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate file space for chunk")
+        if (H5F_addr_ge(new_addr, rec->chunk_addr)) {
+            if (H5MF_xfree(f, H5FD_MEM_DRAW, new_addr, (hsize_t)rec->nbytes) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free file space for chunk")
+            continue;
+        } /* end if */
+
+        /* Copy the chunk to its new location */
+        if (rec->nbytes > buf_size) {
+            void *new_buf; /* Resized buffer */
+
+            if (NULL == (new_buf = H5MM_realloc(buf, (size_t)rec->nbytes)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk")
+            buf      = new_buf;
+            buf_size = rec->nbytes;
+        } /* end if */
+        if (H5F_block_read(f, H5FD_MEM_DRAW, rec->chunk_addr, (size_t)rec->nbytes, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        if (H5F_block_write(f, H5FD_MEM_DRAW, new_addr, (size_t)rec->nbytes, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data chunk")
+
+        /* Point the index at the new location */
+        insert_udata.chunk_block.offset = new_addr;
+        insert_udata.chunk_block.length = rec->nbytes;
+        insert_udata.filter_mask        = rec->filter_mask;
+        insert_udata.common.scaled      = rec->scaled;
+        insert_udata.common.layout      = idx_info.layout;
+        insert_udata.common.storage     = idx_info.storage;
+        if ((idx_info.storage->ops->insert)(&idx_info, &insert_udata, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to update chunk address in index")
+
+        /* A single chunk's address is kept in the layout message */
+        if (H5D_CHUNK_IDX_SINGLE == idx_info.storage->idx_type)
+            if (H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to mark layout as dirty")
+
+        /* Release the old location */
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, rec->chunk_addr, (hsize_t)rec->nbytes) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free file space for chunk")
+
+        *nmoved += rec->nbytes;
+    } /* end for */
+
+done:
+    H5MM_xfree(udata.recs);
+    H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_relocate() */
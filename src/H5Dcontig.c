@@ -102,7 +102,12 @@ static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max
 static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
-static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t           H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static H5D_rdcdc_win_t *H5D__contig_sieve_find(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len);
+static void             H5D__contig_sieve_invalidate(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len);
+static herr_t           H5D__contig_sieve_load(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig,
+                                               const H5D_contig_storage_t *store_contig, haddr_t addr,
+                                               hsize_t dst_off);
 
 /*********************/
 /* Package Variables */
@@ -536,6 +541,48 @@ H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
     FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
 } /* end H5D__contig_is_data_cached() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_free_sieve_buf
+ *
+ * Purpose:     Free the data sieve buffer and the retained sieve windows
+ *              of a contiguous dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_free_sieve_buf(H5D_shared_t *shared_dset)
+{
+    H5D_rdcdc_t *dset_contig; /* Cached information about contiguous data */
+    unsigned     u;           /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(shared_dset);
+
+    dset_contig = &shared_dset->cache.contig;
+
+    /* Free the data sieve buffer, if it's been allocated */
+    if (dset_contig->sieve_buf)
+        dset_contig->sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->sieve_buf);
+    dset_contig->sieve_alloc = 0;
+
+    /* Free the retained windows */
+    for (u = 0; u < H5D_SIEVE_NWIN; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->sieve_win[u];
+
+        if (win->buf)
+            win->buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->buf);
+        win->alloc = 0;
+        win->loc   = HADDR_UNDEF;
+        win->size  = 0;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_free_sieve_buf() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_io_init
  *
@@ -668,6 +715,190 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_find
+ *
+ * Purpose:	Look for a retained sieve window that holds an entire
+ *              request.
+ *
+ * Return:	Pointer to the window on success/NULL if no window holds
+ *              the request
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcdc_win_t *
+H5D__contig_sieve_find(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned         u;                /* Local index variable */
+    H5D_rdcdc_win_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWIN; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->sieve_win[u];
+
+        if (win->size > 0 && addr >= win->loc && (addr + len) <= (win->loc + win->size)) {
+            win->age  = ++dset_contig->sieve_clock;
+            ret_value = win;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_invalidate
+ *
+ * Purpose:	Drop the retained sieve windows that overlap a range of the
+ *              file that is about to be written.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__contig_sieve_invalidate(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWIN; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->sieve_win[u];
+
+        /* Keep the buffer around for the next window */
+        if (win->size > 0 && addr < (win->loc + win->size) && win->loc < (addr + len)) {
+            win->loc  = HADDR_UNDEF;
+            win->size = 0;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_sieve_invalidate() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_load
+ *
+ * Purpose:	Load the sieve buffer with the data starting at a read
+ *              request that isn't held by any sieve window.
+ *
+ *              A read that starts where a window ends is part of a
+ *              sequential scan: the window it continues is dropped and
+ *              the new one is read ahead, doubling in size up to
+ *              H5D_SIEVE_READAHEAD times the sieve buffer size.  Any
+ *              other read (strided, interleaved or random) retains the
+ *              current sieve buffer in the least recently used window,
+ *              so later reads can come back to it without any I/O.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_load(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, const H5D_contig_storage_t *store_contig,
+                       haddr_t addr, hsize_t dst_off)
+{
+    H5D_rdcdc_win_t *win       = NULL;    /* Window to retain the sieve buffer in */
+    size_t           prev_size = 0;       /* Size of the window continued by a sequential read */
+    size_t           new_size;            /* Size of the new sieve buffer */
+    haddr_t          rel_eoa;             /* Relative end of file address	*/
+    hsize_t          max_data;            /* Actual maximum size of data to cache */
+    hsize_t          min;                 /* temporary minimum value (avoids some ugly macro nesting) */
+    unsigned         u;                   /* Local index variable */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Flush the sieve buffer if it's dirty */
+    if (dset_contig->sieve_dirty) {
+        /* Write to file */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
+                                   dset_contig->sieve_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+        /* Reset sieve buffer dirty flag */
+        dset_contig->sieve_dirty = FALSE;
+    } /* end if */
+
+    /* Detect the access pattern, if the sieve buffer holds any data */
+    if (dset_contig->sieve_buf && dset_contig->sieve_size > 0 && H5F_addr_defined(dset_contig->sieve_loc)) {
+        if (H5F_addr_eq(dset_contig->sieve_loc + dset_contig->sieve_size, addr))
+            prev_size = dset_contig->sieve_size;
+        else {
+            /* Pick a window continued by this read, or else the least recently used one */
+            for (u = 0; u < H5D_SIEVE_NWIN; u++) {
+                H5D_rdcdc_win_t *tmp_win = &dset_contig->sieve_win[u];
+
+                if (tmp_win->size > 0 && H5F_addr_eq(tmp_win->loc + tmp_win->size, addr)) {
+                    prev_size = tmp_win->size;
+                    win       = tmp_win;
+                    break;
+                } /* end if */
+                if (NULL == win || (win->size > 0 && (0 == tmp_win->size || tmp_win->age < win->age)))
+                    win = tmp_win;
+            } /* end for */
+
+            /* Swap the sieve buffer into the window, reusing the window's buffer */
+            {
+                unsigned char *tmp_buf   = win->buf;
+                size_t         tmp_alloc = win->alloc;
+
+                win->buf                 = dset_contig->sieve_buf;
+                win->alloc               = dset_contig->sieve_alloc;
+                win->loc                 = dset_contig->sieve_loc;
+                win->size                = dset_contig->sieve_size;
+                win->age                 = ++dset_contig->sieve_clock;
+                dset_contig->sieve_buf   = tmp_buf;
+                dset_contig->sieve_alloc = tmp_alloc;
+            }
+        } /* end else */
+    }     /* end if */
+
+    /* Read ahead for sequential scans */
+    new_size = dset_contig->sieve_buf_size;
+    if (prev_size > 0)
+        new_size = MIN(MAX(2 * prev_size, new_size), H5D_SIEVE_READAHEAD * dset_contig->sieve_buf_size);
+
+    /* Allocate room for the data sieve buffer */
+    if (NULL == dset_contig->sieve_buf) {
+        if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, new_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        dset_contig->sieve_alloc = new_size;
+    } /* end if */
+    else if (dset_contig->sieve_alloc < new_size) {
+        if (NULL == (dset_contig->sieve_buf = H5FL_BLK_REALLOC(sieve_buf, dset_contig->sieve_buf, new_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        dset_contig->sieve_alloc = new_size;
+    } /* end if */
+
+    /* Determine the new sieve buffer size & location */
+    dset_contig->sieve_loc = addr;
+
+    /* Make certain we don't read off the end of the file */
+    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+
+    /* Only need this when resizing sieve buffer */
+    max_data = store_contig->dset_size - dst_off;
+
+    /* Compute the size of the sieve buffer.
+     * Don't read off the end of the file, don't read past
+     * the end of the data element, and don't read more than
+     * the buffer size.
+     */
+    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, new_size);
+    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+
+    /* Read the new sieve buffer */
+    if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
+                              dset_contig->sieve_buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_load() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -689,23 +920,19 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
         udata->store_contig; /* Contiguous storage info for this I/O operation */
-    unsigned char *buf;      /* Pointer to buffer to fill */
-    haddr_t        addr;     /* Actual address to read */
+    unsigned char *  buf;    /* Pointer to buffer to fill */
+    haddr_t          addr;   /* Actual address to read */
     haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    haddr_t          contig_end;                                /* End locations of block to write */
+    H5D_rdcdc_win_t *win;                                       /* Retained sieve window */
+    herr_t           ret_value = SUCCEED;                       /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Stash local copies of these value */
     if (dset_contig->sieve_buf != NULL) {
         sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
+        sieve_end   = sieve_start + dset_contig->sieve_size;
     } /* end if */
 
     /* Compute offset on disk */
@@ -714,122 +941,46 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     /* Compute offset in memory */
     buf = udata->rbuf + src_off;
 
-    /* Check if the sieve buffer is allocated yet */
-    if (NULL == dset_contig->sieve_buf) {
-        /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-        } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    /* Compute end of sequence to retrieve */
+    contig_end = addr + len - 1;
 
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
+    /* If entire read is within the sieve buffer, read it from the buffer */
+    if (dset_contig->sieve_buf != NULL && addr >= sieve_start && contig_end < sieve_end) {
+        unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
 
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+        /* Grab the data out of the buffer */
+        H5MM_memcpy(buf, base_sieve_buf, len);
+    } /* end if */
+    /* Check if we can actually hold the I/O request in the sieve buffer */
+    else if (len > dset_contig->sieve_buf_size) {
+        /* Check for any overlap with the current sieve buffer */
+        if (dset_contig->sieve_dirty && ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
+                                         ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1)))) {
+            /* Write to file */
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, dset_contig->sieve_size,
+                                       dset_contig->sieve_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
             /* Reset sieve buffer dirty flag */
             dset_contig->sieve_dirty = FALSE;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
-
-        /* If entire read is within the sieve buffer, read it from the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
-
-            /* Grab the data out of the buffer */
-            H5MM_memcpy(buf, base_sieve_buf, len);
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-                }     /* end if */
-
-                /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Flush the sieve buffer if it's dirty */
-                if (dset_contig->sieve_dirty) {
-                    /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                    /* Reset sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = FALSE;
-                } /* end if */
-
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
-
-                /* Make certain we don't read off the end of the file */
-                if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                /* Only need this when resizing sieve buffer */
-                max_data = store_contig->dset_size - dst_off;
-
-                /* Compute the size of the sieve buffer.
-                 * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
-                 */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-
-                /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+        /* Read directly into the user's buffer */
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+    } /* end if */
+    /* If entire read is within a retained window, read it from the window */
+    else if (NULL != (win = H5D__contig_sieve_find(dset_contig, addr, len)))
+        H5MM_memcpy(buf, win->buf + (addr - win->loc), len);
+    /* Element size fits within the buffer size */
+    else {
+        /* Load the sieve buffer with the data starting at this read */
+        if (H5D__contig_sieve_load(f_sh, dset_contig, store_contig, addr, dst_off) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load sieve buffer")
 
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = FALSE;
-            } /* end else */
-        }     /* end else */
-    }         /* end else */
+        /* Grab the data out of the buffer (must be first piece of data in buffer ) */
+        H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -981,6 +1132,9 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
+    /* Drop any retained sieve windows this write makes stale */
+    H5D__contig_sieve_invalidate(dset_contig, addr, len);
+
     /* No data sieve buffer yet, go allocate one */
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
@@ -992,6 +1146,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
             /* Allocate room for the data sieve buffer */
             if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+            dset_contig->sieve_alloc = dset_contig->sieve_buf_size;
 
             /* Clear memory */
             if (dset_contig->sieve_size > len)
@@ -1561,3 +1716,81 @@ done:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_relocate
+ *
+ * Purpose:     Move the raw data of a contiguous dataset to free space
+ *              lower in the file, when the file space allocator can place
+ *              it below its current address.  The old space is released
+ *              afterwards, so freed space at the end of the file shrinks
+ *              the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_relocate(H5D_t *dset, hsize_t *nmoved)
+{
+    H5O_storage_contig_t *storage = &dset->shared->layout.storage.u.contig; /* Contiguous storage */
+    H5F_t *               f       = dset->oloc.file;                        /* File of the dataset */
+    haddr_t               new_addr;                                         /* New address of the data */
+    hsize_t               offset;                                           /* Offset of the block to copy */
+    void *                buf       = NULL;                                 /* Buffer for moving the data */
+    size_t                buf_size  = 0;                                    /* Size of the buffer */
+    herr_t                ret_value = SUCCEED;                              /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity checks */
+    HDassert(H5D_CONTIGUOUS == dset->shared->layout.type);
+    HDassert(nmoved);
+
+    /* Data in external files isn't in this file's address space */
+    if (dset->shared->dcpl_cache.efl.nused > 0 || !H5F_addr_defined(storage->addr) || 0 == storage->size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate space for the data, and keep it only when it is lower in the file */
+    if (HADDR_UNDEF == (new_addr = H5MF_alloc(f, H5FD_MEM_DRAW, storage->size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate file space for raw data")
+    if (H5F_addr_ge(new_addr, storage->addr)) {
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, new_addr, storage->size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free file space for raw data")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Write out and drop the sieve buffers, as they hold the current address */
+    if (H5D__flush_sieve_buf(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush data sieve buffer")
+    H5D__contig_free_sieve_buf(dset->shared);
+    dset->shared->cache.contig.sieve_loc  = HADDR_UNDEF;
+    dset->shared->cache.contig.sieve_size = 0;
+
+    /* Copy the data to its new location */
+    H5_CHECKED_ASSIGN(buf_size, size_t, MIN(H5D_TEMP_BUF_SIZE, storage->size), hsize_t);
+    if (NULL == (buf = H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data buffer")
+    for (offset = 0; offset < storage->size; offset += buf_size) {
+        size_t nbytes = (size_t)MIN(buf_size, storage->size - offset); /* Bytes to copy */
+
+        if (H5F_block_read(f, H5FD_MEM_DRAW, storage->addr + offset, nbytes, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data")
+        if (H5F_block_write(f, H5FD_MEM_DRAW, new_addr + offset, nbytes, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data")
+    } /* end for */
+
+    /* Release the old location and point the layout at the new one */
+    if (H5MF_xfree(f, H5FD_MEM_DRAW, storage->addr, storage->size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free file space for raw data")
+    storage->addr = new_addr;
+    if (H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to mark layout as dirty")
+
+    *nmoved += storage->size;
+
+done:
+    H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__contig_relocate() */
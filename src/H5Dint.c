@@ -116,9 +116,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_chunk_info_t struct */
 H5FL_EXTERN(H5D_chunk_info_t);
 
@@ -1933,9 +1930,7 @@ H5D_close(H5D_t *dataset)
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                H5D__contig_free_sieve_buf(dataset->shared);
                 break;
 
             case H5D_CHUNKED:
@@ -2127,9 +2122,7 @@ H5D_mult_refresh_close(hid_t dset_id)
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                H5D__contig_free_sieve_buf(dataset->shared);
                 break;
 
             case H5D_CHUNKED:
@@ -3563,6 +3556,55 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_flush_all() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5D_relocate_storage
+ *
+ * Purpose:  Move the raw data of a dataset to free space lower in the
+ *           file, adding the number of bytes moved to NMOVED.  Chunked
+ *           datasets stop moving chunks once NMOVED reaches MAX_BYTES
+ *           (0 for no limit).
+ *
+ * Return:   Success:    Non-negative
+ *           Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_relocate_storage(H5D_t *dset, hsize_t max_bytes, hsize_t *nmoved)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(nmoved);
+
+    switch (dset->shared->layout.type) {
+        case H5D_CONTIGUOUS:
+            if (H5D__contig_relocate(dset, nmoved) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTMOVE, FAIL, "unable to move contiguous raw data")
+            break;
+
+        case H5D_CHUNKED:
+            if (H5D__chunk_relocate(dset, max_bytes, nmoved) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTMOVE, FAIL, "unable to move raw data chunks")
+            break;
+
+        case H5D_COMPACT:
+        case H5D_VIRTUAL:
+            /* Nothing stored in the file outside the object header */
+            break;
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        default:
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unknown storage method")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_relocate_storage() */
+
 /*-------------------------------------------------------------------------
  * Function: H5D_get_create_plist
  *
@@ -51,6 +51,9 @@ static herr_t H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t d
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, const H5S_t *file_space,
                                  const H5S_t *mem_space, const H5D_type_info_t *type_info);
+static herr_t H5D__multi_collective_io(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+                                       const H5S_t *mem_spaces[], const H5S_t *file_spaces[], void *rbufs[],
+                                       const void *wbufs[], hbool_t *io_done);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
@@ -568,6 +571,214 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) multiple datasets into application memory
+ *		buffers.  See H5Dread_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], const H5S_t *mem_spaces[],
+                const H5S_t *file_spaces[], void *bufs[] /*out*/)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value	*/
+
+    FUNC_ENTER_PACKAGE
+
+#ifdef H5_HAVE_PARALLEL
+    {
+        hbool_t io_done = FALSE; /* Whether the data was read collectively */
+
+        /* Try reading all datasets with one collective I/O operation */
+        if (H5D__multi_collective_io(count, dsets, mem_type_ids, mem_spaces, file_spaces, bufs, NULL,
+                                     &io_done) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data collectively")
+        if (io_done)
+            HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Read the datasets one at a time */
+    for (u = 0; u < count; u++)
+        if (H5D__read(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) multiple datasets from application memory
+ *		buffers.  See H5Dwrite_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], const H5S_t *mem_spaces[],
+                 const H5S_t *file_spaces[], const void *bufs[])
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value	*/
+
+    FUNC_ENTER_PACKAGE
+
+#ifdef H5_HAVE_PARALLEL
+    {
+        hbool_t io_done = FALSE; /* Whether the data was written collectively */
+
+        /* Try writing all datasets with one collective I/O operation */
+        if (H5D__multi_collective_io(count, dsets, mem_type_ids, mem_spaces, file_spaces, NULL, bufs,
+                                     &io_done) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data collectively")
+        if (io_done)
+            HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Write the datasets one at a time */
+    for (u = 0; u < count; u++)
+        if (H5D__write(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_collective_io
+ *
+ * Purpose:	Attempt to read (RBUFS non-NULL) or write (WBUFS non-NULL)
+ *		multiple datasets with a single collective MPI-IO
+ *		operation.
+ *
+ *		This is only possible when a collective transfer is
+ *		requested, all datasets are in the same file, use
+ *		contiguous storage that has been allocated, and no
+ *		datatype conversion or data transform is needed.  As the
+ *		I/O is collective, all processes must agree on this, so
+ *		the local decision is combined with that of the other
+ *		processes.
+ *
+ *		IO_DONE is set to TRUE if the I/O was performed, otherwise
+ *		the caller must perform the I/O one dataset at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_collective_io(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], const H5S_t *mem_spaces[],
+                         const H5S_t *file_spaces[], void *rbufs[], const void *wbufs[], hbool_t *io_done)
+{
+    H5D_multi_io_info_t *info = NULL;           /* Per-dataset I/O info */
+    H5F_t *              f;                     /* File for the datasets */
+    H5FD_mpio_xfer_t     io_xfer_mode;          /* MPI I/O transfer mode */
+    hbool_t              local_possible = TRUE; /* Whether collective I/O is possible locally */
+    size_t               u;                     /* Local index variable */
+    herr_t               ret_value = SUCCEED;   /* Return value	*/
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(count > 0);
+    HDassert(dsets && dsets[0]);
+    HDassert(rbufs || wbufs);
+    HDassert(io_done);
+
+    *io_done = FALSE;
+    f        = dsets[0]->oloc.file;
+
+    /* Only combine the I/O for collective transfers to more than one dataset */
+    if (count < 2 || !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+    if (H5CX_get_io_xfer_mode(&io_xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+    if (io_xfer_mode != H5FD_MPIO_COLLECTIVE)
+        HGOTO_DONE(SUCCEED)
+
+    /* Optimized MPI types flag must be set */
+    /* (based on 'HDF5_MPI_OPT_TYPES' environment variable) */
+    if (!H5FD_mpi_opt_types_g || count > (size_t)INT_MAX)
+        local_possible = FALSE;
+
+    if (NULL == (info = (H5D_multi_io_info_t *)H5MM_calloc(count * sizeof(H5D_multi_io_info_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate multi-dataset I/O info")
+
+    /* Check whether each dataset can take part in the combined I/O */
+    for (u = 0; u < count && local_possible; u++) {
+        H5D_t *         dset = dsets[u];
+        const H5S_t *   file_space;
+        const H5S_t *   mem_space;
+        H5D_type_info_t type_info; /* Datatype info for operation */
+        hbool_t         conv_noop; /* Whether no datatype conversion or transform is needed */
+
+        file_space = file_spaces[u] ? file_spaces[u] : dset->shared->space;
+        mem_space  = mem_spaces[u] ? mem_spaces[u] : file_space;
+
+        /* The storage must be allocated contiguous storage in the same file */
+        if (H5F_SHARED(dset->oloc.file) != H5F_SHARED(f) || dset->shared->layout.type != H5D_CONTIGUOUS ||
+            dset->shared->dcpl_cache.efl.nused > 0 ||
+            !(*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage))
+            local_possible = FALSE;
+        /* The data must be writable */
+        else if (wbufs && 0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
+            local_possible = FALSE;
+        /* The dataspaces must be simple or scalar, with matching selections */
+        else if (!((H5S_SIMPLE == H5S_GET_EXTENT_TYPE(mem_space) ||
+                    H5S_SCALAR == H5S_GET_EXTENT_TYPE(mem_space)) &&
+                   (H5S_SIMPLE == H5S_GET_EXTENT_TYPE(file_space) ||
+                    H5S_SCALAR == H5S_GET_EXTENT_TYPE(file_space))) ||
+                 H5S_GET_EXTENT_NDIMS(mem_space) != H5S_GET_EXTENT_NDIMS(file_space) ||
+                 H5S_GET_SELECT_NPOINTS(mem_space) != H5S_GET_SELECT_NPOINTS(file_space))
+            local_possible = FALSE;
+        /* There must be a buffer if any elements are selected */
+        else if (H5S_GET_SELECT_NPOINTS(file_space) > 0 && (rbufs ? !rbufs[u] : !wbufs[u]))
+            local_possible = FALSE;
+        else {
+            /* No datatype conversion or data transform may be needed */
+            if (H5D__typeinfo_init(dset, mem_type_ids[u], (hbool_t)(wbufs != NULL), &type_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
+            conv_noop = (hbool_t)(type_info.is_conv_noop && type_info.is_xform_noop);
+            info[u].elmt_size = type_info.src_type_size;
+            if (H5D__typeinfo_term(&type_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+
+            if (!conv_noop)
+                local_possible = FALSE;
+        } /* end else */
+
+        info[u].addr       = dset->shared->layout.storage.u.contig.addr;
+        info[u].file_space = file_space;
+        info[u].mem_space  = mem_space;
+        if (rbufs)
+            info[u].u.rbuf = rbufs[u];
+        else
+            info[u].u.wbuf = wbufs[u];
+    } /* end for */
+
+    /* Perform the combined I/O, if all processes can take part */
+    if (H5D__mpio_multi_collective_io(f, (rbufs ? H5D_IO_OP_READ : H5D_IO_OP_WRITE), count, info,
+                                      local_possible, io_done) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_IO, FAIL, "multi-dataset collective I/O failed")
+
+done:
+    H5MM_xfree(info);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_collective_io() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
  *
@@ -207,6 +207,12 @@ typedef struct H5D_filtered_collective_io_info_t {
     } async_info;
 } H5D_filtered_collective_io_info_t;
 
+/* A range of the file accessed through an aggregator during two-phase I/O */
+typedef struct H5D_mpio_aggr_piece_t {
+    haddr_t offset; /* Address of the range in the file */
+    hsize_t len;    /* Length of the range in bytes */
+} H5D_mpio_aggr_piece_t;
+
 /* Function pointer typedef for sort function */
 typedef int (*H5D_mpio_sort_func_cb_t)(const void *, const void *);
 
@@ -225,6 +231,9 @@ static herr_t H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, con
                                                      H5D_chunk_map_t *fm);
 static herr_t H5D__inter_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                        const H5S_t *file_space, const H5S_t *mem_space);
+static herr_t H5D__mpio_two_phase_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                     const H5S_t *file_space, const H5S_t *mem_space, unsigned num_aggr,
+                                     hsize_t align);
 static herr_t H5D__final_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                        hsize_t nelmts, MPI_Datatype mpi_file_type, MPI_Datatype mpi_buf_type);
 static herr_t H5D__sort_chunk(H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
@@ -249,6 +258,10 @@ static herr_t H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_
                                       size_t array_entry_size, void **gathered_array,
                                       size_t *gathered_array_num_entries, hbool_t allgather, int root,
                                       MPI_Comm comm, int (*sort_func)(const void *, const void *));
+static herr_t H5D__mpio_gather_chunk_alloc_info(const H5D_filtered_collective_io_info_t *chunk_list,
+                                               size_t chunk_list_num_entries, MPI_Comm comm,
+                                               H5D_chunk_alloc_info_t **alloc_info,
+                                               size_t *alloc_info_num_entries, size_t *local_offset);
 static herr_t H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chunk_list,
                                                        size_t num_entries, MPI_Datatype *new_mem_type,
                                                        hbool_t *mem_type_derived, MPI_Datatype *new_file_type,
@@ -260,6 +273,8 @@ static herr_t H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io
 static int    H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2);
 static int    H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
                                                          const void *filtered_collective_io_info_entry2);
+static int    H5D__cmp_multi_io_info(const void *multi_io_info1, const void *multi_io_info2);
+static int    H5D__cmp_mpio_aggr_piece(const void *piece1, const void *piece2);
 #if MPI_VERSION >= 3
 static int H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
                                                             const void *filtered_collective_io_info_entry2);
@@ -638,6 +653,113 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__mpio_array_gatherv() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_gather_chunk_alloc_info
+ *
+ * Purpose:     Gather the allocation information (chunk index, current
+ *              and new location) of the chunks in each process' list of
+ *              filtered chunks to all processes, so that they can take
+ *              part in the collective re-allocation of the chunks.
+ *
+ *              The information from each process is stored in rank
+ *              order; LOCAL_OFFSET is set to the position of this
+ *              process' first chunk in the gathered array.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_gather_chunk_alloc_info(const H5D_filtered_collective_io_info_t *chunk_list,
+                                  size_t chunk_list_num_entries, MPI_Comm comm,
+                                  H5D_chunk_alloc_info_t **alloc_info, size_t *alloc_info_num_entries,
+                                  size_t *local_offset)
+{
+    H5D_chunk_alloc_info_t *local_info = NULL;   /* This process' chunk allocation info */
+    H5D_chunk_alloc_info_t *gathered   = NULL;   /* Chunk allocation info from all processes */
+    int *                   counts     = NULL;   /* Number of bytes from each process */
+    int *                   displs     = NULL;   /* Displacement of each process' info */
+    size_t                  total      = 0;      /* Number of chunks from all processes */
+    int                     local_count;         /* Number of chunks on this process */
+    int                     mpi_rank, mpi_size, mpi_code;
+    int                     i;                   /* Local index variable */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_list || 0 == chunk_list_num_entries);
+    HDassert(alloc_info);
+    HDassert(alloc_info_num_entries);
+    HDassert(local_offset);
+
+    *alloc_info             = NULL;
+    *alloc_info_num_entries = 0;
+    *local_offset           = 0;
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_rank(comm, &mpi_rank)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_rank failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_size(comm, &mpi_size)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_size failed", mpi_code)
+
+    if (NULL == (counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive counts array")
+    if (NULL == (displs = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive displacements array")
+
+    /* Find out how many chunks each process has */
+    H5_CHECKED_ASSIGN(local_count, int, chunk_list_num_entries, size_t);
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&local_count, 1, MPI_INT, counts, 1, MPI_INT, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+    /* Convert the chunk counts to byte counts and displacements */
+    for (i = 0; i < mpi_size; i++) {
+        if (i == mpi_rank)
+            *local_offset = total;
+        total += (size_t)counts[i];
+        H5_CHECKED_ASSIGN(counts[i], int, (size_t)counts[i] * sizeof(H5D_chunk_alloc_info_t), size_t);
+        displs[i] = (i == 0) ? 0 : displs[i - 1] + counts[i - 1];
+    } /* end for */
+
+    /* If no process is writing anything, there is nothing to do */
+    if (0 == total)
+        HGOTO_DONE(SUCCEED)
+
+    /* Fill in this process' chunk allocation info */
+    if (chunk_list_num_entries) {
+        size_t u;
+
+        if (NULL == (local_info = (H5D_chunk_alloc_info_t *)H5MM_malloc(chunk_list_num_entries *
+                                                                         sizeof(H5D_chunk_alloc_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk allocation info")
+        for (u = 0; u < chunk_list_num_entries; u++) {
+            local_info[u].index         = chunk_list[u].index;
+            local_info[u].chunk_current = chunk_list[u].chunk_states.chunk_current;
+            local_info[u].new_chunk     = chunk_list[u].chunk_states.new_chunk;
+            local_info[u].need_insert   = FALSE;
+        } /* end for */
+    }     /* end if */
+
+    if (NULL == (gathered = (H5D_chunk_alloc_info_t *)H5MM_malloc(total * sizeof(H5D_chunk_alloc_info_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate gathered chunk allocation info")
+
+    /* Exchange the chunk allocation info with all processes */
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgatherv(local_info, counts[mpi_rank], MPI_BYTE, gathered, counts,
+                                                  displs, MPI_BYTE, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
+
+    *alloc_info             = gathered;
+    *alloc_info_num_entries = total;
+    gathered                = NULL;
+
+done:
+    H5MM_xfree(gathered);
+    H5MM_xfree(local_info);
+    H5MM_xfree(displs);
+    H5MM_xfree(counts);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_gather_chunk_alloc_info() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__mpio_get_sum_chunk
  *
@@ -693,6 +815,7 @@ H5D__contig_collective_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_
                             hsize_t H5_ATTR_UNUSED nelmts, const H5S_t *file_space, const H5S_t *mem_space,
                             H5D_chunk_map_t H5_ATTR_UNUSED *fm)
 {
+    unsigned                  num_aggr;                 /* # of two-phase I/O aggregators */
     H5D_mpio_actual_io_mode_t actual_io_mode = H5D_MPIO_CONTIGUOUS_COLLECTIVE;
     herr_t                    ret_value      = SUCCEED; /* Return value */
 
@@ -701,9 +824,25 @@ H5D__contig_collective_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_
     /* Sanity check */
     HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
 
-    /* Call generic internal collective I/O routine */
-    if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't finish shared collective MPI-IO")
+    /* Get the two-phase I/O settings */
+    if (H5CX_get_mpio_aggr_num(&num_aggr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of I/O aggregators")
+
+    if (num_aggr > 0) {
+        hsize_t align; /* File domain alignment */
+
+        if (H5CX_get_mpio_aggr_align(&align) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O aggregator alignment")
+
+        /* Aggregate the I/O within the library */
+        if (H5D__mpio_two_phase_io(io_info, type_info, file_space, mem_space, num_aggr, align) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't finish two-phase I/O")
+    } /* end if */
+    else {
+        /* Call generic internal collective I/O routine */
+        if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "couldn't finish shared collective MPI-IO")
+    } /* end else */
 
     /* Set the actual I/O mode property. internal_collective_io will not break to
      * independent I/O, so we set it here.
@@ -732,6 +871,7 @@ H5D__contig_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type
                              hsize_t H5_ATTR_UNUSED nelmts, const H5S_t *file_space, const H5S_t *mem_space,
                              H5D_chunk_map_t H5_ATTR_UNUSED *fm)
 {
+    unsigned                  num_aggr;                 /* # of two-phase I/O aggregators */
     H5D_mpio_actual_io_mode_t actual_io_mode = H5D_MPIO_CONTIGUOUS_COLLECTIVE;
     herr_t                    ret_value      = SUCCEED; /* Return value */
 
@@ -740,9 +880,25 @@ H5D__contig_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type
     /* Sanity check */
     HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
 
-    /* Call generic internal collective I/O routine */
-    if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't finish shared collective MPI-IO")
+    /* Get the two-phase I/O settings */
+    if (H5CX_get_mpio_aggr_num(&num_aggr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of I/O aggregators")
+
+    if (num_aggr > 0) {
+        hsize_t align; /* File domain alignment */
+
+        if (H5CX_get_mpio_aggr_align(&align) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O aggregator alignment")
+
+        /* Aggregate the I/O within the library */
+        if (H5D__mpio_two_phase_io(io_info, type_info, file_space, mem_space, num_aggr, align) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't finish two-phase I/O")
+    } /* end if */
+    else {
+        /* Call generic internal collective I/O routine */
+        if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't finish shared collective MPI-IO")
+    } /* end else */
 
     /* Set the actual I/O mode property. internal_collective_io will not break to
      * independent I/O, so we set it here.
@@ -753,6 +909,649 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_collective_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_two_phase_io
+ *
+ * Purpose:     Reads or writes the selection of a contiguous dataset with
+ *              two-phase I/O performed within the library, instead of
+ *              relying on the collective buffering of the MPI-IO library.
+ *
+ *              The range of the file accessed by all processes is split
+ *              into NUM_AGGR domains which start on multiples of ALIGN.
+ *              Each process splits its file sequences at the domain
+ *              boundaries and exchanges them, along with the data for a
+ *              write, with the aggregator process owning each domain
+ *              using MPI_Alltoallv.  The aggregators then access their
+ *              domain with a single independent request, reading it
+ *              first when a write does not cover the whole range, and
+ *              for a read, send the data back the same way.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_two_phase_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, const H5S_t *file_space,
+                       const H5S_t *mem_space, unsigned num_aggr, hsize_t align)
+{
+    H5S_sel_iter_t *       mem_iter       = NULL;     /* Memory selection iterator */
+    hbool_t                mem_iter_init  = FALSE;    /* Whether mem_iter is initialized */
+    H5S_sel_iter_t *       file_iter      = NULL;     /* File selection iterator */
+    hbool_t                file_iter_init = FALSE;    /* Whether file_iter is initialized */
+    H5D_mpio_aggr_piece_t *seqs           = NULL;     /* File sequences of the selection */
+    size_t                 nseqs          = 0;        /* # of file sequences */
+    size_t                 seqs_alloc     = 0;        /* # of file sequences allocated */
+    H5D_mpio_aggr_piece_t *pieces         = NULL;     /* Sequences split at domain boundaries */
+    int *                  piece_dest     = NULL;     /* Aggregator receiving each piece */
+    size_t *               piece_pos      = NULL;     /* Position of the pieces in packed_buf */
+    size_t                 npieces        = 0;        /* # of pieces */
+    size_t                 pieces_alloc   = 0;        /* # of pieces allocated */
+    H5D_mpio_aggr_piece_t *send_meta      = NULL;     /* Pieces, in the order they are sent */
+    size_t *               send_pos       = NULL;     /* Position of send_meta in packed_buf */
+    H5D_mpio_aggr_piece_t *recv_meta      = NULL;     /* Pieces received by this aggregator */
+    H5D_mpio_aggr_piece_t *sorted_meta    = NULL;     /* recv_meta, sorted by address */
+    size_t                 recv_npieces   = 0;        /* # of pieces received */
+    size_t                 recv_nbytes    = 0;        /* # of bytes received */
+    int *                  counts         = NULL;     /* # of pieces & bytes for each process */
+    int *                  recv_counts    = NULL;     /* # of pieces & bytes from each process */
+    int *                  send_cnts      = NULL;     /* MPI_Alltoallv send counts */
+    int *                  send_displs    = NULL;     /* MPI_Alltoallv send displacements */
+    int *                  recv_cnts      = NULL;     /* MPI_Alltoallv receive counts */
+    int *                  recv_displs    = NULL;     /* MPI_Alltoallv receive displacements */
+    unsigned char *        packed_buf     = NULL;     /* Selected data, in selection order */
+    unsigned char *        send_buf       = NULL;     /* Data sent */
+    unsigned char *        recv_buf       = NULL;     /* Data received */
+    unsigned char *        aggr_buf       = NULL;     /* Aggregator's file domain */
+    H5FD_mpio_xfer_t       xfer_mode;                 /* Original transfer mode */
+    hbool_t                restore_xfer_mode = FALSE; /* Whether xfer_mode must be restored */
+    haddr_t                dset_addr;                 /* Address of the dataset in the file */
+    size_t                 elmt_size;                 /* Size of each element */
+    hsize_t                nelmts = 0;                /* # of elements selected */
+    uint64_t               local_range[2];            /* Min. address & (max - end) address */
+    uint64_t               global_range[2];           /* Same, for all processes */
+    haddr_t                domain_start;              /* Start of the first file domain */
+    hsize_t                domain_size;               /* Size of each file domain */
+    int                    mpi_size;                  /* # of processes */
+    size_t                 u;                         /* Local index variable */
+    int                    i;                         /* Local index variable */
+    int                    mpi_code;                  /* MPI return code */
+    herr_t                 ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(type_info);
+    HDassert(num_aggr > 0);
+    HDassert(align > 0);
+
+    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
+    if (num_aggr > (unsigned)mpi_size)
+        num_aggr = (unsigned)mpi_size;
+
+    dset_addr = io_info->store->contig.dset_addr;
+    elmt_size = type_info->src_type_size;
+    if (file_space && mem_space)
+        nelmts = (hsize_t)H5S_GET_SELECT_NPOINTS(file_space);
+
+    if (nelmts > 0) {
+        size_t nbytes; /* Size of the packed buffer */
+
+        nbytes = (size_t)nelmts * elmt_size;
+        if (NULL == (packed_buf = (unsigned char *)H5MM_malloc(nbytes)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate packed data buffer")
+
+        /* Gather the data to write in selection order */
+        if (io_info->op_type == H5D_IO_OP_WRITE) {
+            if (NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate memory selection iterator")
+            if (H5S_select_iter_init(mem_iter, mem_space, elmt_size, 0) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection iterator")
+            mem_iter_init = TRUE;
+
+            if ((size_t)nelmts != H5D__gather_mem(io_info->u.wbuf, mem_iter, (size_t)nelmts, packed_buf))
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mem gather failed")
+        } /* end if */
+
+        /* Retrieve the file sequences of the selection, in selection order */
+        if (NULL == (file_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate file selection iterator")
+        if (H5S_select_iter_init(file_iter, file_space, elmt_size, 0) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize file selection iterator")
+        file_iter_init = TRUE;
+
+        while (nbytes > 0) {
+            hsize_t off[H5D_IO_VECTOR_SIZE]; /* File offsets of the sequences */
+            size_t  len[H5D_IO_VECTOR_SIZE]; /* Lengths of the sequences */
+            size_t  seq_nelem;               /* # of elements in the sequences */
+            size_t  seq_nbytes = 0;          /* # of bytes in the sequences */
+            size_t  seq_count;               /* # of sequences retrieved */
+
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(file_iter, (size_t)H5D_IO_VECTOR_SIZE, (size_t)-1, &seq_count,
+                                             &seq_nelem, off, len) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed")
+            if (seq_count == 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "selection iterator ended early")
+
+            if (nseqs + seq_count > seqs_alloc) {
+                H5D_mpio_aggr_piece_t *tmp_seqs;
+
+                seqs_alloc = MAX(2 * seqs_alloc, nseqs + seq_count);
+                if (NULL == (tmp_seqs = (H5D_mpio_aggr_piece_t *)H5MM_realloc(
+                                 seqs, seqs_alloc * sizeof(H5D_mpio_aggr_piece_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't grow file sequence list")
+                seqs = tmp_seqs;
+            } /* end if */
+
+            for (u = 0; u < seq_count; u++) {
+                seqs[nseqs].offset = dset_addr + off[u];
+                seqs[nseqs].len    = (hsize_t)len[u];
+                nseqs++;
+                seq_nbytes += len[u];
+            } /* end for */
+
+            HDassert(seq_nbytes <= nbytes);
+            nbytes -= seq_nbytes;
+        } /* end while */
+    }     /* end if */
+
+    /* Determine the range of the file accessed by all processes */
+    local_range[0] = UINT64_MAX;
+    local_range[1] = UINT64_MAX;
+    for (u = 0; u < nseqs; u++) {
+        local_range[0] = MIN(local_range[0], (uint64_t)seqs[u].offset);
+        local_range[1] = MIN(local_range[1], UINT64_MAX - (uint64_t)(seqs[u].offset + seqs[u].len));
+    } /* end for */
+    if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(local_range, global_range, 2, MPI_UINT64_T, MPI_MIN,
+                                                 io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+
+    /* Nothing to do if no process has anything selected */
+    if (global_range[0] == UINT64_MAX)
+        HGOTO_DONE(SUCCEED)
+
+    /* Split the range into aligned file domains, one per aggregator */
+    domain_start = (haddr_t)(global_range[0] - (global_range[0] % align));
+    domain_size  = ((UINT64_MAX - global_range[1]) - domain_start + num_aggr - 1) / num_aggr;
+    domain_size  = ((domain_size + align - 1) / align) * align;
+
+    /* Split the file sequences at the domain boundaries */
+    {
+        size_t pos = 0; /* Position in the packed buffer */
+
+        for (u = 0; u < nseqs; u++) {
+            haddr_t seq_off = seqs[u].offset;
+            hsize_t seq_len = seqs[u].len;
+
+            while (seq_len > 0) {
+                hsize_t domain = (seq_off - domain_start) / domain_size;
+                hsize_t piece_len = MIN(seq_len, domain_start + ((domain + 1) * domain_size) - seq_off);
+
+                if (npieces == pieces_alloc) {
+                    H5D_mpio_aggr_piece_t *tmp_pieces;
+                    int *                  tmp_dest;
+                    size_t *               tmp_pos;
+
+                    pieces_alloc = MAX(2 * pieces_alloc, nseqs);
+                    if (NULL == (tmp_pieces = (H5D_mpio_aggr_piece_t *)H5MM_realloc(
+                                     pieces, pieces_alloc * sizeof(H5D_mpio_aggr_piece_t))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't grow piece list")
+                    pieces = tmp_pieces;
+                    if (NULL == (tmp_dest = (int *)H5MM_realloc(piece_dest, pieces_alloc * sizeof(int))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't grow piece list")
+                    piece_dest = tmp_dest;
+                    if (NULL == (tmp_pos = (size_t *)H5MM_realloc(piece_pos, pieces_alloc * sizeof(size_t))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't grow piece list")
+                    piece_pos = tmp_pos;
+                } /* end if */
+
+                /* Spread the aggregators evenly over the processes */
+                pieces[npieces].offset = seq_off;
+                pieces[npieces].len    = piece_len;
+                piece_dest[npieces]    = (int)((domain * (hsize_t)mpi_size) / num_aggr);
+                piece_pos[npieces]     = pos;
+                npieces++;
+
+                pos += (size_t)piece_len;
+                seq_off += piece_len;
+                seq_len -= piece_len;
+            } /* end while */
+        }     /* end for */
+    }
+
+    /* Count the pieces and bytes to send to each process */
+    if (NULL == (counts = (int *)H5MM_calloc(6 * (size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate count arrays")
+    recv_counts = counts + (2 * mpi_size);
+    send_cnts   = counts + (4 * mpi_size);
+    send_displs = counts + (5 * mpi_size);
+    if (NULL == (recv_cnts = (int *)H5MM_malloc(2 * (size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate count arrays")
+    recv_displs = recv_cnts + mpi_size;
+
+    for (u = 0; u < npieces; u++) {
+        hsize_t nbytes = (hsize_t)counts[(2 * piece_dest[u]) + 1] + pieces[u].len;
+
+        if (nbytes > (hsize_t)INT_MAX)
+            HGOTO_ERROR(H5E_DATASET, H5E_OVERFLOW, FAIL, "too much data for one aggregator")
+        counts[2 * piece_dest[u]]++;
+        counts[(2 * piece_dest[u]) + 1] = (int)nbytes;
+    } /* end for */
+
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Alltoall(counts, 2, MPI_INT, recv_counts, 2, MPI_INT, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
+
+    /* Order the pieces by destination, keeping the selection order for each one */
+    if (npieces > 0) {
+        if (NULL ==
+            (send_meta = (H5D_mpio_aggr_piece_t *)H5MM_malloc(npieces * sizeof(H5D_mpio_aggr_piece_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate send buffer")
+        if (NULL == (send_pos = (size_t *)H5MM_malloc(npieces * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate send buffer")
+    } /* end if */
+    for (i = 0, u = 0; i < mpi_size; i++) {
+        send_displs[i] = (int)u;
+        u += (size_t)counts[2 * i];
+    } /* end for */
+    for (u = 0; u < npieces; u++) {
+        int idx = send_displs[piece_dest[u]]++;
+
+        send_meta[idx] = pieces[u];
+        send_pos[idx]  = piece_pos[u];
+    } /* end for */
+
+    /* Exchange the pieces */
+    for (i = 0; i < mpi_size; i++) {
+        hsize_t recv_meta_size = (hsize_t)recv_npieces * sizeof(H5D_mpio_aggr_piece_t);
+
+        if (recv_meta_size > (hsize_t)INT_MAX ||
+            (hsize_t)counts[2 * i] * sizeof(H5D_mpio_aggr_piece_t) > (hsize_t)INT_MAX)
+            HGOTO_ERROR(H5E_DATASET, H5E_OVERFLOW, FAIL, "too many pieces for one aggregator")
+        send_cnts[i]   = counts[2 * i] * (int)sizeof(H5D_mpio_aggr_piece_t);
+        send_displs[i] = (i == 0) ? 0 : send_displs[i - 1] + send_cnts[i - 1];
+        recv_cnts[i]   = recv_counts[2 * i] * (int)sizeof(H5D_mpio_aggr_piece_t);
+        recv_displs[i] = (int)recv_meta_size;
+        recv_npieces += (size_t)recv_counts[2 * i];
+        recv_nbytes += (size_t)recv_counts[(2 * i) + 1];
+    } /* end for */
+    if ((hsize_t)recv_npieces * sizeof(H5D_mpio_aggr_piece_t) > (hsize_t)INT_MAX ||
+        (hsize_t)recv_nbytes > (hsize_t)INT_MAX)
+        HGOTO_ERROR(H5E_DATASET, H5E_OVERFLOW, FAIL, "too much data for one aggregator")
+
+    if (recv_npieces > 0)
+        if (NULL ==
+            (recv_meta = (H5D_mpio_aggr_piece_t *)H5MM_malloc(recv_npieces * sizeof(H5D_mpio_aggr_piece_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate receive buffer")
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_meta, send_cnts, send_displs, MPI_BYTE, recv_meta,
+                                                 recv_cnts, recv_displs, MPI_BYTE, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+    /* Set up the counts and displacements for the data, as seen by the aggregators */
+    for (i = 0; i < mpi_size; i++) {
+        send_cnts[i]   = counts[(2 * i) + 1];
+        send_displs[i] = (i == 0) ? 0 : send_displs[i - 1] + send_cnts[i - 1];
+        recv_cnts[i]   = recv_counts[(2 * i) + 1];
+        recv_displs[i] = (i == 0) ? 0 : recv_displs[i - 1] + recv_cnts[i - 1];
+    } /* end for */
+
+    /* Pack the data to send in the order of the pieces */
+    if (io_info->op_type == H5D_IO_OP_WRITE) {
+        size_t pos = 0; /* Position in the send buffer */
+
+        if (npieces > 0)
+            if (NULL == (send_buf = (unsigned char *)H5MM_malloc((size_t)nelmts * elmt_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate send buffer")
+        for (u = 0; u < npieces; u++) {
+            H5MM_memcpy(send_buf + pos, packed_buf + send_pos[u], (size_t)send_meta[u].len);
+            pos += (size_t)send_meta[u].len;
+        } /* end for */
+
+        if (recv_nbytes > 0)
+            if (NULL == (recv_buf = (unsigned char *)H5MM_malloc(recv_nbytes)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate receive buffer")
+        if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_buf, send_cnts, send_displs, MPI_BYTE, recv_buf,
+                                                     recv_cnts, recv_displs, MPI_BYTE, io_info->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+    } /* end if */
+
+    /* Access the aggregator's file domain with a single independent request */
+    if (recv_npieces > 0) {
+        haddr_t ext_lo = HADDR_MAX; /* Start of the range accessed */
+        haddr_t ext_hi = 0;         /* End of the range accessed */
+        size_t  ext_len;            /* Length of the range accessed */
+        size_t  pos;                /* Position in the receive buffer */
+
+        for (u = 0; u < recv_npieces; u++) {
+            ext_lo = MIN(ext_lo, recv_meta[u].offset);
+            ext_hi = MAX(ext_hi, recv_meta[u].offset + recv_meta[u].len);
+        } /* end for */
+        ext_len = (size_t)(ext_hi - ext_lo);
+
+        if (NULL == (aggr_buf = (unsigned char *)H5MM_malloc(ext_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate aggregation buffer")
+
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if (H5CX_set_io_xfer_mode(H5FD_MPIO_INDEPENDENT) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+        restore_xfer_mode = TRUE;
+
+        if (io_info->op_type == H5D_IO_OP_WRITE) {
+            hbool_t holes = FALSE; /* Whether the pieces leave parts of the range unwritten */
+
+            /* Check whether the pieces cover the whole range */
+            if (NULL == (sorted_meta = (H5D_mpio_aggr_piece_t *)H5MM_malloc(recv_npieces *
+                                                                             sizeof(H5D_mpio_aggr_piece_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate piece list")
+            H5MM_memcpy(sorted_meta, recv_meta, recv_npieces * sizeof(H5D_mpio_aggr_piece_t));
+            HDqsort(sorted_meta, recv_npieces, sizeof(H5D_mpio_aggr_piece_t), H5D__cmp_mpio_aggr_piece);
+            {
+                haddr_t covered = ext_lo; /* End of the range covered so far */
+
+                for (u = 0; u < recv_npieces && !holes; u++) {
+                    if (sorted_meta[u].offset > covered)
+                        holes = TRUE;
+                    covered = MAX(covered, sorted_meta[u].offset + sorted_meta[u].len);
+                } /* end for */
+            }
+
+            /* Read the range first if it will only be partially overwritten */
+            if (holes)
+                if (H5F_shared_block_read(io_info->f_sh, H5FD_MEM_DRAW, ext_lo, ext_len, aggr_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read aggregation domain")
+
+            for (u = 0, pos = 0; u < recv_npieces; u++) {
+                H5MM_memcpy(aggr_buf + (recv_meta[u].offset - ext_lo), recv_buf + pos,
+                            (size_t)recv_meta[u].len);
+                pos += (size_t)recv_meta[u].len;
+            } /* end for */
+
+            if (H5F_shared_block_write(io_info->f_sh, H5FD_MEM_DRAW, ext_lo, ext_len, aggr_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write aggregation domain")
+        } /* end if */
+        else {
+            if (H5F_shared_block_read(io_info->f_sh, H5FD_MEM_DRAW, ext_lo, ext_len, aggr_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read aggregation domain")
+
+            /* Pack the data requested by each process in the order of its pieces */
+            if (NULL == (recv_buf = (unsigned char *)H5MM_malloc(recv_nbytes)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate send buffer")
+            for (u = 0, pos = 0; u < recv_npieces; u++) {
+                H5MM_memcpy(recv_buf + pos, aggr_buf + (recv_meta[u].offset - ext_lo),
+                            (size_t)recv_meta[u].len);
+                pos += (size_t)recv_meta[u].len;
+            } /* end for */
+        } /* end else */
+
+        if (H5CX_set_io_xfer_mode(xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+        restore_xfer_mode = FALSE;
+    } /* end if */
+
+    /* Send the data read back to the processes that selected it */
+    if (io_info->op_type == H5D_IO_OP_READ) {
+        size_t pos = 0; /* Position in the receive buffer */
+
+        if (npieces > 0)
+            if (NULL == (send_buf = (unsigned char *)H5MM_malloc((size_t)nelmts * elmt_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate receive buffer")
+        if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(recv_buf, recv_cnts, recv_displs, MPI_BYTE, send_buf,
+                                                     send_cnts, send_displs, MPI_BYTE, io_info->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+        for (u = 0; u < npieces; u++) {
+            H5MM_memcpy(packed_buf + send_pos[u], send_buf + pos, (size_t)send_meta[u].len);
+            pos += (size_t)send_meta[u].len;
+        } /* end for */
+
+        /* Scatter the data read to memory */
+        if (nelmts > 0) {
+            if (NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "couldn't allocate memory selection iterator")
+            if (H5S_select_iter_init(mem_iter, mem_space, elmt_size, 0) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection iterator")
+            mem_iter_init = TRUE;
+
+            if (H5D__scatter_mem(packed_buf, mem_iter, (size_t)nelmts, io_info->u.rbuf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+        } /* end if */
+    }     /* end if */
+
+done:
+    if (restore_xfer_mode && H5CX_set_io_xfer_mode(xfer_mode) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+    if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+    H5MM_free(mem_iter);
+    H5MM_free(file_iter);
+    H5MM_free(seqs);
+    H5MM_free(pieces);
+    H5MM_free(piece_dest);
+    H5MM_free(piece_pos);
+    H5MM_free(send_meta);
+    H5MM_free(send_pos);
+    H5MM_free(recv_meta);
+    H5MM_free(sorted_meta);
+    H5MM_free(counts);
+    H5MM_free(recv_cnts);
+    H5MM_free(packed_buf);
+    H5MM_free(send_buf);
+    H5MM_free(recv_buf);
+    H5MM_free(aggr_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_two_phase_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_collective_io
+ *
+ * Purpose:     Read or write the selections of several contiguous
+ *              datasets in the same file with a single collective I/O
+ *              operation.
+ *
+ *              The MPI file and memory datatypes of each dataset are
+ *              combined into one MPI derived datatype for the file and
+ *              one for memory, in increasing order of the datasets'
+ *              addresses in the file, so that the MPI-IO layer only sees
+ *              one file view.
+ *
+ *              LOCAL_POSSIBLE indicates whether this process can take
+ *              part in the combined I/O.  If any process cannot, no I/O
+ *              is performed and IO_DONE is set to FALSE so that the
+ *              caller can fall back to accessing each dataset in turn.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_collective_io(H5F_t *f, H5D_io_op_type_t op_type, size_t count, H5D_multi_io_info_t *info,
+                              hbool_t local_possible, hbool_t *io_done)
+{
+    MPI_Datatype *file_types            = NULL;              /* MPI file datatype for each dataset */
+    MPI_Datatype *mem_types             = NULL;              /* MPI memory datatype for each dataset */
+    hbool_t *     file_type_is_derived  = NULL;              /* Whether each file datatype is derived */
+    hbool_t *     mem_type_is_derived   = NULL;              /* Whether each memory datatype is derived */
+    int *         file_counts           = NULL;              /* Count of each file datatype */
+    int *         mem_counts            = NULL;              /* Count of each memory datatype */
+    MPI_Aint *    file_disps            = NULL;              /* File displacement of each dataset */
+    MPI_Aint *    mem_disps             = NULL;              /* Memory displacement of each buffer */
+    MPI_Datatype  final_file_type       = MPI_DATATYPE_NULL; /* Combined MPI file datatype */
+    MPI_Datatype  final_mem_type        = MPI_DATATYPE_NULL; /* Combined MPI memory datatype */
+    hbool_t       final_file_is_derived = FALSE;             /* Whether the file datatype was created */
+    hbool_t       final_mem_is_derived  = FALSE;             /* Whether the memory datatype was created */
+    MPI_Aint      base_mem_addr;                             /* Address of the base buffer */
+    haddr_t       base_addr;                                 /* File address of the first dataset */
+    const void *  base_wbuf             = NULL;              /* Base buffer for memory displacements (wr) */
+    void *        base_rbuf             = NULL;              /* Base buffer for memory displacements (rd) */
+    char          fake_buf              = 0;                 /* Buffer used when no buffer is given */
+    MPI_Comm      comm;                                      /* MPI communicator for the file */
+    int           local_flag;                                /* Local "combined I/O possible" flag */
+    int           global_flag;                               /* Global "combined I/O possible" flag */
+    size_t        u;                                         /* Local index variable */
+    int           mpi_code;                                  /* MPI return code */
+    herr_t        ret_value             = SUCCEED;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(count > 0 && count <= (size_t)INT_MAX);
+    HDassert(info);
+    HDassert(io_done);
+
+    *io_done = FALSE;
+
+    if (MPI_COMM_NULL == (comm = H5F_mpi_get_comm(f)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve MPI communicator")
+
+    /* All processes must be able to take part in the combined I/O */
+    local_flag = (int)local_possible;
+    if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&local_flag, &global_flag, 1, MPI_INT, MPI_LAND, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+    if (!global_flag)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the per-dataset MPI datatype information */
+    if (NULL == (file_types = (MPI_Datatype *)H5MM_malloc(count * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file datatype buffer")
+    if (NULL == (mem_types = (MPI_Datatype *)H5MM_malloc(count * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory datatype buffer")
+    if (NULL == (file_type_is_derived = (hbool_t *)H5MM_calloc(count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file derived datatype flags buffer")
+    if (NULL == (mem_type_is_derived = (hbool_t *)H5MM_calloc(count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                    "couldn't allocate memory derived datatype flags buffer")
+    if (NULL == (file_counts = (int *)H5MM_calloc(count * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file counts buffer")
+    if (NULL == (mem_counts = (int *)H5MM_calloc(count * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory counts buffer")
+    if (NULL == (file_disps = (MPI_Aint *)H5MM_malloc(count * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file displacement buffer")
+    if (NULL == (mem_disps = (MPI_Aint *)H5MM_malloc(count * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory displacement buffer")
+
+    /* The file view must be in increasing address order */
+    HDqsort(info, count, sizeof(H5D_multi_io_info_t), H5D__cmp_multi_io_info);
+    base_addr = info[0].addr;
+
+    /* Memory displacements are relative to the first buffer given */
+    for (u = 0; u < count && !base_rbuf && !base_wbuf; u++) {
+        if (op_type == H5D_IO_OP_READ)
+            base_rbuf = info[u].u.rbuf;
+        else
+            base_wbuf = info[u].u.wbuf;
+    } /* end for */
+    if (!base_rbuf && !base_wbuf) {
+        base_rbuf = &fake_buf;
+        base_wbuf = &fake_buf;
+    } /* end if */
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_address((op_type == H5D_IO_OP_READ ? base_rbuf : base_wbuf),
+                                                   &base_mem_addr)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+
+    /* Obtain the file and memory MPI datatypes for each dataset */
+    for (u = 0; u < count; u++) {
+        const void *buf = (op_type == H5D_IO_OP_READ) ? (const void *)info[u].u.rbuf : info[u].u.wbuf;
+        hsize_t *   permute_map = NULL; /* Mapping of out-of-order point selections */
+        hbool_t     is_permuted = FALSE;
+        MPI_Aint    mem_addr;
+
+        /* NOTE: The permute_map array can be allocated within H5S_mpio_space_type
+         *              and will be fed into the next call to H5S_mpio_space_type
+         *              where it will be freed.
+         */
+        if (H5S_mpio_space_type(info[u].file_space, info[u].elmt_size, &file_types[u], &file_counts[u],
+                                &file_type_is_derived[u], TRUE, &permute_map, &is_permuted) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI file type")
+        if (H5S_mpio_space_type(info[u].mem_space, info[u].elmt_size, &mem_types[u], &mem_counts[u],
+                                &mem_type_is_derived[u], FALSE, &permute_map, &is_permuted) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI buffer type")
+        HDassert(!permute_map);
+
+        /* Dataset address relative to the first dataset */
+        /* (assume MPI_Aint big enough to hold it) */
+        file_disps[u] = (MPI_Aint)(info[u].addr - base_addr);
+
+        /* Buffer address relative to the base buffer */
+        if (buf) {
+            if (MPI_SUCCESS != (mpi_code = MPI_Get_address(buf, &mem_addr)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+#if MPI_VERSION >= 3 && MPI_SUBVERSION >= 1
+            mem_disps[u] = MPI_Aint_diff(mem_addr, base_mem_addr);
+#else
+            mem_disps[u] = mem_addr - base_mem_addr;
+#endif
+        } /* end if */
+        else
+            mem_disps[u] = 0;
+    } /* end for */
+
+    /* Create final MPI derived datatype for the file */
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_create_struct((int)count, file_counts, file_disps, file_types,
+                                                          &final_file_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+    final_file_is_derived = TRUE;
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_file_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+    /* Create final MPI derived datatype for memory */
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_create_struct((int)count, mem_counts, mem_disps, mem_types,
+                                                          &final_mem_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+    final_mem_is_derived = TRUE;
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_mem_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+    /* Pass buf type, file type to the file driver */
+    if (H5CX_set_mpi_coll_datatypes(final_mem_type, final_file_type) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O collective I/O datatypes")
+
+    /* Perform the I/O for all datasets with one single, complicated MPI datatype */
+    if (op_type == H5D_IO_OP_WRITE) {
+        if (H5F_shared_block_write(H5F_SHARED(f), H5FD_MEM_DRAW, base_addr, (size_t)1, base_wbuf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't finish collective parallel write")
+    } /* end if */
+    else {
+        if (H5F_shared_block_read(H5F_SHARED(f), H5FD_MEM_DRAW, base_addr, (size_t)1, base_rbuf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't finish collective parallel read")
+    } /* end else */
+
+    H5CX_set_mpio_actual_io_mode(H5D_MPIO_CONTIGUOUS_COLLECTIVE);
+    *io_done = TRUE;
+
+done:
+    /* Release the MPI datatypes */
+    if (final_file_is_derived)
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_file_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if (final_mem_is_derived)
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_mem_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    for (u = 0; u < count; u++) {
+        if (file_type_is_derived && file_type_is_derived[u])
+            if (MPI_SUCCESS != (mpi_code = MPI_Type_free(file_types + u)))
+                HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if (mem_type_is_derived && mem_type_is_derived[u])
+            if (MPI_SUCCESS != (mpi_code = MPI_Type_free(mem_types + u)))
+                HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end for */
+    H5MM_xfree(file_types);
+    H5MM_xfree(mem_types);
+    H5MM_xfree(file_type_is_derived);
+    H5MM_xfree(mem_type_is_derived);
+    H5MM_xfree(file_counts);
+    H5MM_xfree(mem_counts);
+    H5MM_xfree(file_disps);
+    H5MM_xfree(mem_disps);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_collective_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_collective_io
  *
@@ -821,6 +1620,12 @@ H5D__chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     /* direct request to multi-chunk-io */
     else if (H5FD_MPIO_CHUNK_MULTI_IO == chunk_opt_mode)
         io_option = H5D_MULTI_CHUNK_IO;
+    /* Filtered writes via default path always use one linked-chunk I/O, which
+     * (re-)allocates the chunks, writes them and updates the chunk index once for
+     * all chunks instead of once per chunk
+     */
+    else if (io_info->op_type == H5D_IO_OP_WRITE && io_info->dset->shared->dcpl_cache.pline.nused > 0)
+        io_option = H5D_ONE_LINK_CHUNK_IO_MORE_OPT;
     /* via default path. branch by num threshold */
     else {
         unsigned one_link_chunk_io_threshold; /* Threshold to use single collective I/O for all chunks */
@@ -1342,17 +2147,17 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
                                        H5D_chunk_map_t *fm)
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list =
-        NULL;                /* The list of chunks used during collective operations */
+    H5D_chunk_alloc_info_t *           alloc_info =
+        NULL;                /* Allocation info of the chunks written by all processes */
     H5D_storage_t ctg_store; /* Chunk storage information as contiguous dataset */
     MPI_Datatype  mem_type             = MPI_BYTE;
     MPI_Datatype  file_type            = MPI_BYTE;
     hbool_t       mem_type_is_derived  = FALSE;
     hbool_t       file_type_is_derived = FALSE;
     size_t        chunk_list_num_entries;
-    size_t        collective_chunk_list_num_entries;
-    size_t *      num_chunks_selected_array = NULL; /* Array of number of chunks selected on each process */
-    size_t        i;                                /* Local index variable */
+    size_t        alloc_info_num_entries = 0;
+    size_t        local_offset           = 0; /* Offset of this process' chunks in alloc_info */
+    size_t        i;                          /* Local index variable */
     int           mpi_rank, mpi_size, mpi_code;
     herr_t        ret_value = SUCCEED;
 
@@ -1407,54 +2212,30 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
         /* Gather the new chunk sizes to all processes for a collective reallocation
-         * of the chunks in the file.
+         * of the chunks in the file.  Only the chunk index and location are exchanged,
+         * not the full chunk entries.
          */
-        if (H5D__mpio_array_gatherv(chunk_list, chunk_list_num_entries,
-                                    sizeof(H5D_filtered_collective_io_info_t),
-                                    (void **)&collective_chunk_list, &collective_chunk_list_num_entries, true,
-                                    0, io_info->comm, NULL) < 0)
+        if (H5D__mpio_gather_chunk_alloc_info(chunk_list, chunk_list_num_entries, io_info->comm, &alloc_info,
+                                              &alloc_info_num_entries, &local_offset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
 
-        /* Collectively re-allocate the modified chunks (from each process) in the file */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            hbool_t insert;
-
-            if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[i].chunk_states.chunk_current,
-                                      &collective_chunk_list[i].chunk_states.new_chunk, &insert,
-                                      collective_chunk_list[i].scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-        } /* end for */
-
-        if (NULL == (num_chunks_selected_array = (size_t *)H5MM_malloc((size_t)mpi_size * sizeof(size_t))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
-
-        if (MPI_SUCCESS !=
-            (mpi_code = MPI_Allgather(&chunk_list_num_entries, 1, MPI_UNSIGNED_LONG_LONG,
-                                      num_chunks_selected_array, 1, MPI_UNSIGNED_LONG_LONG, io_info->comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+        /* Collectively re-allocate the modified chunks (from each process) in the file,
+         * with one file space allocation for all of them
+         */
+        if (H5D__chunk_file_alloc_batch(&index_info, alloc_info_num_entries, alloc_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
 
         /* If this process has any chunks selected, create a MPI type for collectively
          * writing out the chunks to file. Otherwise, the process contributes to the
          * collective write with a none type.
          */
         if (chunk_list_num_entries) {
-            size_t offset;
-
-            /* During the collective re-allocation of chunks in the file, the record for each
-             * chunk is only updated in the collective array, not in the local copy of chunks on each
-             * process. However, each process needs the updated chunk records so that they can create
-             * a MPI type for the collective write that will write to the chunk's possible new locations
-             * in the file instead of the old ones. This ugly hack seems to be the best solution to
-             * copy the information back to the local array and avoid having to modify the collective
-             * write type function in an ugly way so that it will accept the collective array instead
-             * of the local array. This works correctly because the array gather function guarantees
-             * that the chunk data in the collective array is ordered in blocks by rank.
+            /* The chunks of each process are stored contiguously, in rank order, in the
+             * gathered array, so copy the possibly new locations of this process' chunks
+             * back to the local array before creating the MPI type for the write.
              */
-            for (i = 0, offset = 0; i < (size_t)mpi_rank; i++)
-                offset += num_chunks_selected_array[i];
-
-            H5MM_memcpy(chunk_list, &collective_chunk_list[offset],
-                        num_chunks_selected_array[mpi_rank] * sizeof(H5D_filtered_collective_io_info_t));
+            for (i = 0; i < chunk_list_num_entries; i++)
+                chunk_list[i].chunk_states.new_chunk = alloc_info[local_offset + i].new_chunk;
 
             /* Create single MPI type encompassing each selection in the dataspace */
             if (H5D__mpio_filtered_collective_write_type(chunk_list, chunk_list_num_entries, &mem_type,
@@ -1480,12 +2261,23 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
             HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish MPI-IO")
 
         /* Participate in the collective re-insertion of all chunks modified
-         * in this iteration into the chunk index
+         * in this operation into the chunk index.  Chunks which kept their
+         * location and size don't need to be re-inserted.
          */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            udata.chunk_block   = collective_chunk_list[i].chunk_states.new_chunk;
-            udata.common.scaled = collective_chunk_list[i].scaled;
-            udata.chunk_idx     = collective_chunk_list[i].index;
+        for (i = 0; i < alloc_info_num_entries; i++) {
+            hsize_t scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+
+            if (!alloc_info[i].need_insert)
+                continue;
+
+            if (H5VM_array_calc_pre(alloc_info[i].index, fm->f_ndims, index_info.layout->down_chunks,
+                                    scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+            scaled[fm->f_ndims] = 0;
+
+            udata.chunk_block   = alloc_info[i].new_chunk;
+            udata.common.scaled = scaled;
+            udata.chunk_idx     = alloc_info[i].index;
 
             if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
@@ -1502,10 +2294,8 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
-    if (num_chunks_selected_array)
-        H5MM_free(num_chunks_selected_array);
-    if (collective_chunk_list)
-        H5MM_free(collective_chunk_list);
+    if (alloc_info)
+        H5MM_free(alloc_info);
 
     /* Free the MPI buf and file types, if they were derived */
     if (mem_type_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&mem_type)))
@@ -2209,6 +2999,56 @@ H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2)
     FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
 } /* end H5D__cmp_chunk_addr() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_mpio_aggr_piece
+ *
+ * Purpose:     Routine to compare the file addresses of the ranges
+ *              accessed through an aggregator during two-phase I/O
+ *
+ * Description: Callback for qsort() to compare range addresses
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_mpio_aggr_piece(const void *piece1, const void *piece2)
+{
+    haddr_t addr1 = HADDR_UNDEF, addr2 = HADDR_UNDEF;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    addr1 = ((const H5D_mpio_aggr_piece_t *)piece1)->offset;
+    addr2 = ((const H5D_mpio_aggr_piece_t *)piece2)->offset;
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
+} /* end H5D__cmp_mpio_aggr_piece() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_multi_io_info
+ *
+ * Purpose:     Routine to compare the file addresses of datasets in a
+ *              multi-dataset I/O operation
+ *
+ * Description: Callback for qsort() to compare dataset addresses
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_multi_io_info(const void *multi_io_info1, const void *multi_io_info2)
+{
+    haddr_t addr1 = HADDR_UNDEF, addr2 = HADDR_UNDEF;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    addr1 = ((const H5D_multi_io_info_t *)multi_io_info1)->addr;
+    addr2 = ((const H5D_multi_io_info_t *)multi_io_info2)->addr;
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
+} /* end H5D__cmp_multi_io_info() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__cmp_filtered_collective_io_info_entry
  *
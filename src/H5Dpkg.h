@@ -83,6 +83,10 @@
 #define H5D_BT2_SPLIT_PERC        100
 #define H5D_BT2_MERGE_PERC        40
 
+/* Data sieve windows for contiguous datasets */
+#define H5D_SIEVE_NWIN      3 /* Number of windows retained for non-sequential reads */
+#define H5D_SIEVE_READAHEAD 4 /* Maximum readahead, in multiples of the sieve buffer size */
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -229,6 +233,20 @@ typedef struct H5D_io_info_t {
     } u;
 } H5D_io_info_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* Per-dataset information for a multi-dataset collective I/O operation */
+typedef struct H5D_multi_io_info_t {
+    haddr_t      addr;       /* Address of the dataset's contiguous storage */
+    size_t       elmt_size;  /* Size of an element in the selections */
+    const H5S_t *file_space; /* Selection in the dataset's dataspace */
+    const H5S_t *mem_space;  /* Selection in memory */
+    union {
+        void *      rbuf; /* Pointer to buffer for read */
+        const void *wbuf; /* Pointer to buffer to write */
+    } u;
+} H5D_multi_io_info_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /******************/
 /* Chunk typedefs */
 /******************/
@@ -283,6 +301,16 @@ typedef struct H5D_chunk_ud_t {
     hsize_t     chunk_idx;        /* Chunk index for EA, FA indexing */
 } H5D_chunk_ud_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* Allocation information for a chunk written collectively */
+typedef struct H5D_chunk_alloc_info_t {
+    hsize_t     index;         /* Linear index of the chunk */
+    H5F_block_t chunk_current; /* Current location of the chunk in the file */
+    H5F_block_t new_chunk;     /* New location and size of the chunk */
+    hbool_t     need_insert;   /* Whether the chunk must be (re)inserted in the index */
+} H5D_chunk_alloc_info_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /* Typedef for "generic" chunk callbacks */
 typedef int (*H5D_chunk_cb_func_t)(const H5D_chunk_rec_t *chunk_rec, void *udata);
 
@@ -423,13 +451,25 @@ typedef struct H5D_rdcc_t {
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
 } H5D_rdcc_t;
 
+/* A clean data sieve window, retained for reads after it was replaced */
+typedef struct H5D_rdcdc_win_t {
+    unsigned char *buf;   /* Buffer holding the window */
+    size_t         alloc; /* Size of the buffer allocated (in bytes) */
+    haddr_t        loc;   /* File location (offset) of the window */
+    size_t         size;  /* Size of the window used (in bytes) */
+    unsigned       age;   /* Time of last use, for LRU replacement */
+} H5D_rdcdc_win_t;
+
 /* The raw data contiguous data cache */
 typedef struct H5D_rdcdc_t {
-    unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
-    size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
-    hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    unsigned char * sieve_buf;                 /* Buffer to hold data sieve buffer */
+    haddr_t         sieve_loc;                 /* File location (offset) of the data sieve buffer */
+    size_t          sieve_size;                /* Size of the data sieve buffer used (in bytes) */
+    size_t          sieve_buf_size;            /* Size of the data sieve buffer (in bytes) */
+    size_t          sieve_alloc;               /* Size of the data sieve buffer allocated (in bytes) */
+    hbool_t         sieve_dirty;               /* Flag to indicate that the data sieve buffer is dirty */
+    H5D_rdcdc_win_t sieve_win[H5D_SIEVE_NWIN]; /* Windows retained for non-sequential reads */
+    unsigned        sieve_clock;               /* Clock for window LRU replacement */
 } H5D_rdcdc_t;
 
 /*
@@ -584,6 +624,10 @@ H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_spac
                         void *buf /*out*/);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
                          const void *buf);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+                              const H5S_t *mem_spaces[], const H5S_t *file_spaces[], void *bufs[] /*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[],
+                               const H5S_t *mem_spaces[], const H5S_t *file_spaces[], const void *bufs[]);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
@@ -614,6 +658,7 @@ H5_DLL herr_t H5D__layout_oh_write(const H5D_t *dataset, H5O_t *oh, unsigned upd
 H5_DLL herr_t  H5D__contig_alloc(H5F_t *f, H5O_storage_contig_t *storage);
 H5_DLL hbool_t H5D__contig_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL hbool_t H5D__contig_is_data_cached(const H5D_shared_t *shared_dset);
+H5_DLL herr_t  H5D__contig_free_sieve_buf(H5D_shared_t *shared_dset);
 H5_DLL herr_t  H5D__contig_fill(const H5D_io_info_t *io_info);
 H5_DLL herr_t  H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
                                 const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
@@ -622,6 +667,7 @@ H5_DLL herr_t  H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *
 H5_DLL herr_t  H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f_dst,
                                 H5O_storage_contig_t *storage_dst, H5T_t *src_dtype, H5O_copy_t *cpy_info);
 H5_DLL herr_t  H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL herr_t  H5D__contig_relocate(H5D_t *dset, hsize_t *nmoved);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t  H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op);
@@ -639,6 +685,8 @@ H5_DLL herr_t  H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t  H5D__chunk_set_sizes(H5D_t *dset);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
+H5_DLL herr_t H5D__chunk_file_alloc_batch(const H5D_chk_idx_info_t *idx_info, size_t nchunks,
+                                          H5D_chunk_alloc_info_t chunks[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk_t *layout_src,
@@ -652,6 +700,7 @@ H5_DLL herr_t H5D__get_offset_copy(const H5D_t *dset, const hsize_t *offset, hsi
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
                                       uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_relocate(H5D_t *dset, hsize_t max_bytes, hsize_t *nmoved);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -727,6 +776,11 @@ H5_DLL herr_t H5D__chunk_collective_write(H5D_io_info_t *io_info, const H5D_type
 H5_DLL htri_t H5D__mpio_opt_possible(const H5D_io_info_t *io_info, const H5S_t *file_space,
                                      const H5S_t *mem_space, const H5D_type_info_t *type_info);
 
+/* MPI-IO function to read or write multiple contiguous datasets with one collective I/O */
+H5_DLL herr_t H5D__mpio_multi_collective_io(H5F_t *f, H5D_io_op_type_t op_type, size_t count,
+                                            H5D_multi_io_info_t *info, hbool_t local_possible,
+                                            hbool_t *io_done);
+
 #endif /* H5_HAVE_PARALLEL */
 
 /* Testing functions */
@@ -74,6 +74,8 @@
 #define H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME   "mpio_chunk_opt_hard"
 #define H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME    "mpio_chunk_opt_num"
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME  "mpio_chunk_opt_ratio"
+#define H5D_XFER_MPIO_AGGR_NUM_NAME         "mpio_aggr_num"   /* # of two-phase I/O aggregators */
+#define H5D_XFER_MPIO_AGGR_ALIGN_NAME       "mpio_aggr_align" /* Two-phase I/O file domain alignment */
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME "actual_chunk_opt_mode"
 #define H5D_MPIO_ACTUAL_IO_MODE_NAME        "actual_io_mode"
 #define H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME                                                              \
@@ -165,6 +167,7 @@ H5_DLL herr_t H5D_mult_refresh_reopen(H5D_t *dataset);
 H5_DLL H5O_loc_t *H5D_oloc(H5D_t *dataset);
 H5_DLL H5G_name_t *H5D_nameof(const H5D_t *dataset);
 H5_DLL herr_t      H5D_flush_all(H5F_t *f);
+H5_DLL herr_t      H5D_relocate_storage(H5D_t *dset, hsize_t max_bytes, hsize_t *nmoved);
 H5_DLL hid_t       H5D_get_create_plist(const H5D_t *dset);
 H5_DLL hid_t       H5D_get_access_plist(const H5D_t *dset);
 
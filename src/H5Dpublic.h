@@ -819,6 +819,53 @@ H5_DLL herr_t H5Dread_async(const char *app_file, const char *app_func, unsigned
                             hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
                             void *buf /*out*/, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Reads raw data from multiple datasets into provided buffers
+ *
+ * \param[in] count          Number of datasets to read from
+ * \param[in] dset_id        Identifiers of the datasets to read from
+ * \param[in] mem_type_id    Identifiers of the memory datatypes
+ * \param[in] mem_space_id   Identifiers of the memory dataspaces
+ * \param[in] file_space_id  Identifiers of the datasets' dataspaces in the file
+ * \param[in] dxpl_id        Identifier of a transfer property list
+ * \param[out] buf           Buffers to receive data read from file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dread_multi() reads \p count datasets, specified by their
+ *          identifiers in the \p dset_id array, from the file into the
+ *          application memory buffers in the \p buf array.  Element \p i
+ *          of the \p mem_type_id, \p mem_space_id, \p file_space_id and
+ *          \p buf arrays is used for the dataset \p dset_id[i], exactly
+ *          as with H5Dread().  Data transfer properties are defined by
+ *          the argument \p dxpl_id and apply to all datasets.
+ *
+ *          When the file is accessed with the MPI-IO file driver and
+ *          collective transfer is requested with H5Pset_dxpl_mpio(), the
+ *          selections in all datasets are combined into a single MPI file
+ *          view and read with one collective MPI-IO operation, instead of
+ *          one per dataset.  This requires all datasets to be located in
+ *          the same file, to use contiguous storage that has been
+ *          allocated, and to need neither datatype conversion nor a data
+ *          transform on any process.  Otherwise, and with all other file
+ *          drivers, the datasets are read one at a time, as with
+ *          H5Dread().
+ *
+ *          As with H5Dread(), all processes must call this function with
+ *          the same datasets, in the same order, when collective transfer
+ *          is requested.
+ *
+ * \see H5Dread(), H5Dwrite_multi()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                            hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -956,6 +1003,50 @@ H5_DLL herr_t H5Dwrite_async(const char *app_file, const char *app_func, unsigne
                              hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
                              const void *buf, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Writes raw data from provided buffers to multiple datasets
+ *
+ * \param[in] count          Number of datasets to write to
+ * \param[in] dset_id        Identifiers of the datasets to write to
+ * \param[in] mem_type_id    Identifiers of the memory datatypes
+ * \param[in] mem_space_id   Identifiers of the memory dataspaces
+ * \param[in] file_space_id  Identifiers of the datasets' dataspaces in the file
+ * \param[in] dxpl_id        Identifier of a transfer property list
+ * \param[in] buf            Buffers with data to be written to the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dwrite_multi() writes \p count datasets, specified by their
+ *          identifiers in the \p dset_id array, from the application
+ *          memory buffers in the \p buf array.  Element \p i of the
+ *          \p mem_type_id, \p mem_space_id, \p file_space_id and \p buf
+ *          arrays is used for the dataset \p dset_id[i], exactly as with
+ *          H5Dwrite().  Data transfer properties are defined by the
+ *          argument \p dxpl_id and apply to all datasets.
+ *
+ *          When the file is accessed with the MPI-IO file driver and
+ *          collective transfer is requested with H5Pset_dxpl_mpio(), the
+ *          selections in all datasets are combined into a single MPI file
+ *          view and written with one collective MPI-IO operation, instead
+ *          of one per dataset.  The conditions are the same as for
+ *          H5Dread_multi().  Otherwise, and with all other file drivers,
+ *          the datasets are written one at a time, as with H5Dwrite().
+ *
+ *          As with H5Dwrite(), all processes must call this function with
+ *          the same datasets, in the same order, when collective transfer
+ *          is requested.
+ *
+ * \see H5Dwrite(), H5Dread_multi()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                             hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
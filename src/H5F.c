@@ -26,6 +26,7 @@
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5ESprivate.h" /* Event Sets                               */
 #include "H5Fpkg.h"      /* File access                              */
+#include "H5FDprivate.h" /* File drivers                             */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5Pprivate.h"  /* Property lists                           */
@@ -1575,6 +1576,118 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_file_image() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_file_image_snapshot
+ *
+ * Purpose:     Takes a read-only snapshot of the image of a file opened
+ *              with the core file driver, without copying it.
+ *
+ *              The snapshot shares the file's memory.  The next write to
+ *              the file gives the file a private copy of its image, so
+ *              the snapshot is unaffected by later changes to the file.
+ *
+ *              The snapshot must be released with
+ *              H5Frelease_file_image_snapshot(), and may be released
+ *              after the file is closed.
+ *
+ * Return:      Success:    Size of the file image
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5Fget_file_image_snapshot(hid_t file_id, const void **buf_ptr /*out*/, void **snapshot /*out*/)
+{
+    H5VL_object_t *vol_obj;   /* File object for file ID  */
+    ssize_t        ret_value; /* Return value             */
+
+    FUNC_ENTER_API((-1))
+    H5TRACE3("Zs", "ixx", file_id, buf_ptr, snapshot);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "not a file ID")
+    if (NULL == buf_ptr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "buf_ptr parameter can't be NULL")
+    if (NULL == snapshot)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "snapshot parameter can't be NULL")
+
+    /* Get the file image snapshot */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_FILE_IMAGE_SNAPSHOT, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, buf_ptr, snapshot, &ret_value) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, (-1), "unable to get file image snapshot")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_file_image_snapshot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Frelease_file_image_snapshot
+ *
+ * Purpose:     Releases a snapshot taken with H5Fget_file_image_snapshot().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Frelease_file_image_snapshot(void *snapshot)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*x", snapshot);
+
+    /* Check args */
+    if (NULL == snapshot)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "snapshot parameter can't be NULL")
+
+    /* Release the snapshot */
+    if (H5FD_core_release_image_snapshot(snapshot) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to release file image snapshot")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Frelease_file_image_snapshot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fcompact
+ *
+ * Purpose:     Moves dataset raw data into free space lower in the file
+ *              and releases the space freed at the end of the file.
+ *
+ *              At most MAX_BYTES bytes are moved per call (0 for no
+ *              limit), so the operation can be spread over several calls.
+ *              The number of bytes moved is returned in BYTES_MOVED; 0
+ *              means there is nothing left that can be moved.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fcompact(hid_t file_id, hsize_t max_bytes, hsize_t *bytes_moved /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* File object for file ID */
+    hsize_t        nmoved    = 0;       /* Number of bytes moved */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ihx", file_id, max_bytes, bytes_moved);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Compact the file */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_COMPACT, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL,
+                           max_bytes, &nmoved) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTMOVE, FAIL, "unable to compact file")
+
+    if (bytes_moved)
+        *bytes_moved = nmoved;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fcompact() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_config
  *
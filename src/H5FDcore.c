@@ -45,6 +45,17 @@ typedef struct H5FD_core_region_t {
     haddr_t end;   /* End address of the region            */
 } H5FD_core_region_t;
 
+/* Memory shared between a file and the snapshots taken of its image.
+ * The memory is released when the last reference to it is dropped.
+ */
+typedef struct H5FD_core_snapshot_t {
+    unsigned char *mem;       /* the shared memory                    */
+    size_t         nrefs;     /* # of references to the memory        */
+    hbool_t        owns_mem;  /* release the memory with the snapshot */
+    hbool_t        use_mmap;  /* memory is a mmap reservation         */
+    size_t         mmap_size; /* size of the reservation              */
+} H5FD_core_snapshot_t;
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying memory).
@@ -92,20 +103,45 @@ typedef struct H5FD_core_t {
     hbool_t                     dirty;        /* changes not saved?       */
     H5FD_file_image_callbacks_t fi_callbacks; /* file image callbacks     */
     H5SL_t *                    dirty_list;   /* dirty parts of the file  */
+    hbool_t                     use_mmap;     /* memory is a mmap reservation */
+    size_t                      mmap_size;    /* size of the reservation  */
+    size_t                      mmap_hwm;     /* high-water mark of touched memory */
+    hbool_t                     user_image;   /* memory is owned by the application */
+    H5FD_core_snapshot_t *      snapshot;     /* snapshots sharing the memory */
+    size_t                      sflags_off;   /* offset of status flags cleared for snapshots */
+    size_t                      sflags_size;  /* size of status flags cleared for snapshots */
+    unsigned char               sflags[8];    /* real value of the cleared status flags */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
 typedef struct H5FD_core_fapl_t {
-    size_t  increment;      /* how much to grow memory */
-    hbool_t backing_store;  /* write to file name on flush */
-    hbool_t write_tracking; /* Whether to track writes */
-    size_t  page_size;      /* Page size for tracked writes */
+    size_t      increment;       /* how much to grow memory */
+    hbool_t     backing_store;   /* write to file name on flush */
+    hbool_t     write_tracking;  /* Whether to track writes */
+    size_t      page_size;       /* Page size for tracked writes */
+    hbool_t     use_mmap;        /* Whether to reserve memory with mmap */
+    size_t      reserve_size;    /* Size of the mmap reservation */
+    const void *user_image;      /* Application-owned file image */
+    size_t      user_image_size; /* Size of the application-owned file image */
 } H5FD_core_fapl_t;
 
 /* Allocate memory in multiples of this size by default */
 #define H5FD_CORE_INCREMENT                8192
 #define H5FD_CORE_WRITE_TRACKING_FLAG      FALSE
 #define H5FD_CORE_WRITE_TRACKING_PAGE_SIZE 524288
+#define H5FD_CORE_USE_MMAP_FLAG            FALSE
+#define H5FD_CORE_MMAP_RESERVE_SIZE        ((size_t)1 << 30)
+
+/* Anonymous mappings are spelled differently on some platforms */
+#if defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H)
+#define H5FD_CORE_HAVE_MMAP
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif /* defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H) */
 
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
@@ -130,6 +166,13 @@ typedef struct H5FD_core_fapl_t {
 static herr_t  H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t  H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t  H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+#ifdef H5FD_CORE_HAVE_MMAP
+static herr_t H5FD__core_remap(H5FD_core_t *file, size_t size);
+#endif /* H5FD_CORE_HAVE_MMAP */
+static herr_t  H5FD__core_resize_mem(H5FD_core_t *file, size_t new_eof);
+static herr_t  H5FD__core_free_mem(H5FD_core_t *file);
+static herr_t  H5FD__core_unshare_mem(H5FD_core_t *file);
+static herr_t  H5FD__core_snapshot_decr(H5FD_core_snapshot_t *snapshot);
 static herr_t  H5FD__core_term(void);
 static void *  H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -405,6 +448,277 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+#ifdef H5FD_CORE_HAVE_MMAP
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_remap
+ *
+ * Purpose:     Reserve a new anonymous mapping of SIZE bytes for the
+ *              file's memory, moving any existing contents into it.
+ *
+ *              Pages of an anonymous mapping are not backed by physical
+ *              memory until they are touched, so a large reservation
+ *              lets the file grow in place without reallocating.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_remap(H5FD_core_t *file, size_t size)
+{
+    void * x;                   /* Pointer to new mapping */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->use_mmap);
+    HDassert(size > file->mmap_size);
+
+    if (MAP_FAILED == (x = HDmmap(NULL, size, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, (HDoff_t)0)))
+        HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to reserve memory mapping")
+
+    /* Move the existing file image, if there is one */
+    if (file->mem) {
+        size_t nbytes = MIN((size_t)file->eof, file->mmap_size);
+
+        H5MM_memcpy(x, file->mem, nbytes);
+        if (HDmunmap(file->mem, file->mmap_size) < 0)
+            HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release memory mapping")
+        file->mmap_hwm = nbytes;
+    } /* end if */
+    else
+        file->mmap_hwm = 0;
+
+    file->mem       = (unsigned char *)x;
+    file->mmap_size = size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_remap() */
+#endif /* H5FD_CORE_HAVE_MMAP */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_resize_mem
+ *
+ * Purpose:     Resize the file's memory buffer to NEW_EOF bytes, zeroing
+ *              any newly exposed bytes.  The EOF value is not changed.
+ *
+ *              Uses the file image callbacks if they were provided.  When
+ *              the memory is a mmap reservation, the buffer only moves if
+ *              the reservation is exhausted, in which case the
+ *              reservation is doubled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_resize_mem(H5FD_core_t *file, size_t new_eof)
+{
+    unsigned char *x;                   /* Pointer to new buffer for file data */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+#ifdef H5FD_CORE_HAVE_MMAP
+    if (file->use_mmap) {
+        /* Double the reservation until the new size fits */
+        if (new_eof > file->mmap_size) {
+            size_t mmap_size = file->mmap_size;
+
+            while (mmap_size < new_eof && mmap_size <= ((size_t)-1) / 2)
+                mmap_size *= 2;
+            if (H5FD__core_remap(file, MAX(mmap_size, new_eof)) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                            "unable to grow memory mapping to %llu bytes", (unsigned long long)new_eof)
+        } /* end if */
+
+        /* Only memory below the high-water mark can hold stale bytes, the
+         * rest of the mapping has never been touched and is already zero.
+         */
+        if (new_eof > file->eof && file->mmap_hwm > file->eof)
+            HDmemset(file->mem + file->eof, 0, MIN(new_eof, file->mmap_hwm) - (size_t)file->eof);
+        file->mmap_hwm = MAX(file->mmap_hwm, new_eof);
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_CORE_HAVE_MMAP */
+
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if (file->fi_callbacks.image_realloc) {
+        if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
+                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes with callback",
+                        (unsigned long long)new_eof)
+    } /* end if */
+    else {
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)new_eof)
+    } /* end else */
+
+    if (file->eof < new_eof)
+        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_resize_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_free_mem
+ *
+ * Purpose:     Release the file's memory buffer, using the file image
+ *              callbacks if they were provided.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_free_mem(H5FD_core_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Memory shared with snapshots or owned by the application is not ours to free */
+    if (file->snapshot) {
+        if (H5FD__core_snapshot_decr(file->snapshot) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release file image snapshot")
+        file->snapshot = NULL;
+        file->mem      = NULL;
+    } /* end if */
+    else if (file->user_image)
+        file->mem = NULL;
+
+    if (file->mem) {
+#ifdef H5FD_CORE_HAVE_MMAP
+        if (file->use_mmap) {
+            if (HDmunmap(file->mem, file->mmap_size) < 0)
+                HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release memory mapping")
+            file->mem = NULL;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+#endif /* H5FD_CORE_HAVE_MMAP */
+
+        /* Use image callback if available */
+        if (file->fi_callbacks.image_free) {
+            if (file->fi_callbacks.image_free(file->mem, H5FD_FILE_IMAGE_OP_FILE_CLOSE,
+                                              file->fi_callbacks.udata) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "image_free callback failed")
+        } /* end if */
+        else
+            H5MM_xfree(file->mem);
+        file->mem = NULL;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_free_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_unshare_mem
+ *
+ * Purpose:     Give the file a private copy of its memory, if the memory
+ *              is currently shared with file image snapshots.  This is
+ *              the "copy" part of copy-on-write and must be called before
+ *              the file's memory is modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_unshare_mem(H5FD_core_t *file)
+{
+    unsigned char *x         = NULL;    /* Pointer to private copy of memory */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (file->snapshot) {
+#ifdef H5FD_CORE_HAVE_MMAP
+        if (file->use_mmap) {
+            void *m;
+
+            if (MAP_FAILED == (m = HDmmap(NULL, file->mmap_size, PROT_READ | PROT_WRITE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, (HDoff_t)0)))
+                HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to reserve memory mapping")
+            x              = (unsigned char *)m;
+            file->mmap_hwm = (size_t)file->eof;
+        } /* end if */
+#endif /* H5FD_CORE_HAVE_MMAP */
+        if (!file->use_mmap)
+            if (NULL == (x = (unsigned char *)H5MM_malloc((size_t)file->eof)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
+
+        H5MM_memcpy(x, file->mem, (size_t)file->eof);
+
+        /* Put back the status flags cleared for the snapshots */
+        if (file->sflags_size > 0) {
+            H5MM_memcpy(x + file->sflags_off, file->sflags, file->sflags_size);
+            file->sflags_size = 0;
+        } /* end if */
+
+        /* Drop the file's reference to the shared memory */
+        if (H5FD__core_snapshot_decr(file->snapshot) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release file image snapshot")
+        file->snapshot = NULL;
+        file->mem      = x;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_unshare_mem() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_snapshot_decr
+ *
+ * Purpose:     Drop a reference to memory shared between a file and its
+ *              image snapshots, releasing it with the last reference.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_snapshot_decr(H5FD_core_snapshot_t *snapshot)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(snapshot);
+    HDassert(snapshot->nrefs > 0);
+
+    if (--snapshot->nrefs == 0) {
+        if (snapshot->owns_mem) {
+#ifdef H5FD_CORE_HAVE_MMAP
+            if (snapshot->use_mmap) {
+                if (HDmunmap(snapshot->mem, snapshot->mmap_size) < 0)
+                    HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release memory mapping")
+            } /* end if */
+#endif /* H5FD_CORE_HAVE_MMAP */
+            if (!snapshot->use_mmap)
+                H5MM_xfree(snapshot->mem);
+        } /* end if */
+        H5MM_xfree(snapshot);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_snapshot_decr() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
  *
@@ -530,10 +844,14 @@ H5Pset_core_write_tracking(hid_t plist_id, hbool_t is_enabled, size_t page_size)
 
     /* Set VFD info values */
     HDmemset(&fa, 0, sizeof(H5FD_core_fapl_t));
-    fa.increment      = old_fa->increment;
-    fa.backing_store  = old_fa->backing_store;
-    fa.write_tracking = is_enabled;
-    fa.page_size      = page_size;
+    fa.increment       = old_fa->increment;
+    fa.backing_store   = old_fa->backing_store;
+    fa.write_tracking  = is_enabled;
+    fa.page_size       = page_size;
+    fa.use_mmap        = old_fa->use_mmap;
+    fa.reserve_size    = old_fa->reserve_size;
+    fa.user_image      = old_fa->user_image;
+    fa.user_image_size = old_fa->user_image_size;
 
     /* Set the property values & the driver for the FAPL */
     if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
@@ -584,6 +902,188 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_core_write_tracking() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_core_mmap
+ *
+ * Purpose:     Enables/disables backing the core VFD's memory with an
+ *              anonymous memory mapping of RESERVE_SIZE bytes.  Enabling
+ *              it also enables write tracking, which can be disabled
+ *              again with a later H5Pset_core_write_tracking() call.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_mmap(hid_t plist_id, hbool_t is_enabled, size_t reserve_size)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    H5FD_core_fapl_t        fa;                  /* Core VFD info */
+    const H5FD_core_fapl_t *old_fa;              /* Old core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ibz", plist_id, is_enabled, reserve_size);
+
+    /* The reservation cannot be zero */
+    if (reserve_size == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "reserve_size cannot be zero")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (old_fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Set VFD info values */
+    HDmemset(&fa, 0, sizeof(H5FD_core_fapl_t));
+    fa.increment       = old_fa->increment;
+    fa.backing_store   = old_fa->backing_store;
+    fa.write_tracking  = is_enabled ? TRUE : old_fa->write_tracking;
+    fa.page_size       = old_fa->page_size;
+    fa.use_mmap        = is_enabled;
+    fa.reserve_size    = reserve_size;
+    fa.user_image      = old_fa->user_image;
+    fa.user_image_size = old_fa->user_image_size;
+
+    /* Set the property values & the driver for the FAPL */
+    if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD as driver")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_core_mmap
+ *
+ * Purpose:     Gets information about whether the core VFD's memory is
+ *              backed by a memory mapping and the size of the mapping.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_mmap(hid_t plist_id, hbool_t *is_enabled /*out*/, size_t *reserve_size /*out*/)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    const H5FD_core_fapl_t *fa;                  /* Core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, is_enabled, reserve_size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Get values */
+    if (is_enabled)
+        *is_enabled = fa->use_mmap;
+    if (reserve_size)
+        *reserve_size = fa->reserve_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_core_image
+ *
+ * Purpose:     Sets an application-owned file image that the core VFD
+ *              opens in place, without copying it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_image(hid_t plist_id, const void *buf_ptr, size_t buf_len)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    H5FD_core_fapl_t        fa;                  /* Core VFD info */
+    const H5FD_core_fapl_t *old_fa;              /* Old core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*xz", plist_id, buf_ptr, buf_len);
+
+    /* validate parameters */
+    if (!(((buf_ptr == NULL) && (buf_len == 0)) || ((buf_ptr != NULL) && (buf_len > 0))))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "inconsistent buf_ptr and buf_len")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (old_fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Set VFD info values */
+    HDmemset(&fa, 0, sizeof(H5FD_core_fapl_t));
+    fa.increment       = old_fa->increment;
+    fa.backing_store   = old_fa->backing_store;
+    fa.write_tracking  = old_fa->write_tracking;
+    fa.page_size       = old_fa->page_size;
+    fa.use_mmap        = old_fa->use_mmap;
+    fa.reserve_size    = old_fa->reserve_size;
+    fa.user_image      = buf_ptr;
+    fa.user_image_size = buf_len;
+
+    /* Set the property values & the driver for the FAPL */
+    if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD as driver")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_image() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_core_image
+ *
+ * Purpose:     Gets the application-owned file image set with
+ *              H5Pset_core_image().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_image(hid_t plist_id, const void **buf_ptr /*out*/, size_t *buf_len /*out*/)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    const H5FD_core_fapl_t *fa;                  /* Core VFD info */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, buf_ptr, buf_len);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADID, FAIL, "can't find object for ID")
+    if (H5FD_CORE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_core_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Get values */
+    if (buf_ptr)
+        *buf_ptr = fa->user_image;
+    if (buf_len)
+        *buf_len = fa->user_image_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_image() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fapl_core
  *
@@ -614,10 +1114,14 @@ H5Pset_fapl_core(hid_t fapl_id, size_t increment, hbool_t backing_store)
 
     /* Set VFD info values */
     HDmemset(&fa, 0, sizeof(H5FD_core_fapl_t));
-    fa.increment      = increment;
-    fa.backing_store  = backing_store;
-    fa.write_tracking = H5FD_CORE_WRITE_TRACKING_FLAG;
-    fa.page_size      = H5FD_CORE_WRITE_TRACKING_PAGE_SIZE;
+    fa.increment       = increment;
+    fa.backing_store   = backing_store;
+    fa.write_tracking  = H5FD_CORE_WRITE_TRACKING_FLAG;
+    fa.page_size       = H5FD_CORE_WRITE_TRACKING_PAGE_SIZE;
+    fa.use_mmap        = H5FD_CORE_USE_MMAP_FLAG;
+    fa.reserve_size    = H5FD_CORE_MMAP_RESERVE_SIZE;
+    fa.user_image      = NULL;
+    fa.user_image_size = 0;
 
     /* Set the property values & the driver for the FAPL */
     if (H5P_set_driver(plist, H5FD_CORE, &fa) < 0)
@@ -690,10 +1194,14 @@ H5FD__core_fapl_get(H5FD_t *_file)
     if (NULL == (fa = (H5FD_core_fapl_t *)H5MM_calloc(sizeof(H5FD_core_fapl_t))))
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
-    fa->increment      = file->increment;
-    fa->backing_store  = (hbool_t)(file->fd >= 0);
-    fa->write_tracking = file->write_tracking;
-    fa->page_size      = file->bstore_page_size;
+    fa->increment       = file->increment;
+    fa->backing_store   = (hbool_t)(file->fd >= 0);
+    fa->write_tracking  = file->write_tracking;
+    fa->page_size       = file->bstore_page_size;
+    fa->use_mmap        = file->use_mmap;
+    fa->reserve_size    = file->use_mmap ? file->mmap_size : H5FD_CORE_MMAP_RESERVE_SIZE;
+    fa->user_image      = file->user_image ? file->mem : NULL;
+    fa->user_image_size = file->user_image ? (size_t)file->eof : 0;
 
     /* Set return value */
     ret_value = fa;
@@ -764,7 +1272,13 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     HDassert(((file_image_info.buffer != NULL) && (file_image_info.size > 0)) ||
              ((file_image_info.buffer == NULL) && (file_image_info.size == 0)));
     HDmemset(&sb, 0, sizeof(sb));
-    if ((file_image_info.buffer != NULL) && !(H5F_ACC_CREAT & flags)) {
+    if (fa->user_image) {
+        /* Application-owned images are used in place, so they can't change */
+        if (flags & (H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL,
+                        "application-owned file images must be opened read-only")
+    } /* end if */
+    else if ((file_image_info.buffer != NULL) && !(H5F_ACC_CREAT & flags)) {
         if (HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW) >= 0)
             HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, NULL, "file already exists")
 
@@ -808,6 +1322,27 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     /* Save file image callbacks */
     file->fi_callbacks = file_image_info.callbacks;
 
+    /* Reserve address space for the file with a memory mapping if asked to.
+     * File image callbacks own the memory, so they take precedence.
+     */
+#ifdef H5FD_CORE_HAVE_MMAP
+    if (fa->use_mmap && !fa->user_image && !file->fi_callbacks.image_malloc &&
+        !file->fi_callbacks.image_realloc && !file->fi_callbacks.image_free) {
+        size_t reserve_size = fa->reserve_size;
+
+        if (!(H5F_ACC_CREAT & flags)) {
+            if (file_image_info.buffer && file_image_info.size > 0)
+                reserve_size = MAX(reserve_size, file_image_info.size);
+            else
+                reserve_size = MAX(reserve_size, (size_t)sb.st_size);
+        } /* end if */
+
+        file->use_mmap = TRUE;
+        if (H5FD__core_remap(file, reserve_size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to reserve memory for file")
+    } /* end if */
+#endif /* H5FD_CORE_HAVE_MMAP */
+
     /* Check the file locking flags in the fapl */
     if (ignore_disabled_file_locks_s != FAIL)
         /* The environment variable was set, so use that preferentially */
@@ -837,8 +1372,17 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 #endif /* H5_HAVE_WIN32_API */
     }  /* end if */
 
+    /* If an application-owned image is opened, use it in place */
+    if (fa->user_image) {
+        /* The image is never written through, see H5FD__core_write() */
+        file->user_image = TRUE;
+        H5_GCC_DIAG_OFF("cast-qual")
+        file->mem = (unsigned char *)fa->user_image; /* (Casting away const OK) */
+        H5_GCC_DIAG_ON("cast-qual")
+        file->eof = fa->user_image_size;
+    } /* end if */
     /* If an existing file is opened, load the whole file into memory. */
-    if (!(H5F_ACC_CREAT & flags)) {
+    else if (!(H5F_ACC_CREAT & flags)) {
         size_t size;
 
         /* Retrieve file size */
@@ -849,8 +1393,12 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 
         /* Check if we should allocate the memory buffer and read in existing data */
         if (size) {
-            /* Allocate memory for the file's data, using the file image callback if available. */
-            if (file->fi_callbacks.image_malloc) {
+            /* Allocate memory for the file's data, using the file image callback if available.
+             * A memory mapping has already been reserved large enough to hold the file.
+             */
+            if (file->use_mmap)
+                file->mmap_hwm = size;
+            else if (file->fi_callbacks.image_malloc) {
                 if (NULL == (file->mem = (unsigned char *)file->fi_callbacks.image_malloc(
                                  size, H5FD_FILE_IMAGE_OP_FILE_OPEN, file->fi_callbacks.udata)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "image malloc callback failed")
@@ -963,7 +1511,12 @@ done:
         if (file->fd >= 0)
             HDclose(file->fd);
         H5MM_xfree(file->name);
-        H5MM_xfree(file->mem);
+        if (file->use_mmap || file->user_image) {
+            if (H5FD__core_free_mem(file) < 0)
+                HDONE_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "unable to release file memory")
+        } /* end if */
+        else
+            H5MM_xfree(file->mem);
         H5MM_xfree(file);
     } /* end if */
 
@@ -1004,16 +1557,8 @@ H5FD__core_close(H5FD_t *_file)
         HDclose(file->fd);
     if (file->name)
         H5MM_xfree(file->name);
-    if (file->mem) {
-        /* Use image callback if available */
-        if (file->fi_callbacks.image_free) {
-            if (file->fi_callbacks.image_free(file->mem, H5FD_FILE_IMAGE_OP_FILE_CLOSE,
-                                              file->fi_callbacks.udata) < 0)
-                HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "image_free callback failed")
-        } /* end if */
-        else
-            H5MM_xfree(file->mem);
-    } /* end if */
+    if (H5FD__core_free_mem(file) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "unable to release file memory")
     HDmemset(file, 0, sizeof(H5FD_core_t));
     H5MM_xfree(file);
 
@@ -1340,6 +1885,17 @@ H5FD__core_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
 #endif /* NDEBUG */
 
         H5MM_memcpy(buf, file->mem + addr, nbytes);
+
+        /* Return the real status flags, if they're cleared for snapshots */
+        if (file->sflags_size > 0 && addr < file->sflags_off + file->sflags_size &&
+            file->sflags_off < addr + nbytes) {
+            haddr_t start = MAX(addr, (haddr_t)file->sflags_off);
+            haddr_t end   = MIN(addr + nbytes, (haddr_t)(file->sflags_off + file->sflags_size));
+
+            H5MM_memcpy((unsigned char *)buf + (start - addr), file->sflags + (start - file->sflags_off),
+                        (size_t)(end - start));
+        } /* end if */
+
         size -= nbytes;
         addr += nbytes;
         buf = (char *)buf + nbytes;
@@ -1383,6 +1939,14 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
 
+    /* Application-owned images are read-only */
+    if (file->user_image)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to application-owned file image")
+
+    /* Stop sharing memory with file image snapshots before changing it */
+    if (H5FD__core_unshare_mem(file) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to copy memory shared with snapshots")
+
     /*
      * Allocate more memory if necessary, careful of overflow. Also, if the
      * allocation fails then the file should remain in a usable state.  Be
@@ -1390,30 +1954,17 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
      * the first argument is null.
      */
     if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
+        size_t new_eof;
 
         /* Determine new size of memory buffer */
         H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
         if ((addr + size) % file->increment)
             new_eof += file->increment;
 
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                             file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
-                            (unsigned long long)new_eof)
-        } /* end if */
-        else {
-            if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
-
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
+        /* (Re)allocate memory for the file buffer */
+        if (H5FD__core_resize_mem(file, new_eof) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)new_eof)
 
         file->eof = new_eof;
     } /* end if */
@@ -1463,6 +2014,9 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
 
     /* Write to backing store */
     if (file->dirty && file->fd >= 0 && file->backing_store) {
+        /* Memory shared with snapshots may have the status flags cleared */
+        if (file->sflags_size > 0 && H5FD__core_unshare_mem(file) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to copy memory shared with snapshots")
 
         /* Use the dirty list, if available */
         if (file->dirty_list) {
@@ -1559,25 +2113,14 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
         } /* end else */
 
         /* Extend the file to make sure it's large enough */
-        if (!H5F_addr_eq(file->eof, (haddr_t)new_eof)) {
-            unsigned char *x; /* Pointer to new buffer for file data */
+        if (!H5F_addr_eq(file->eof, (haddr_t)new_eof) && !file->user_image) {
+            /* Stop sharing memory with file image snapshots before changing it */
+            if (H5FD__core_unshare_mem(file) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to copy memory shared with snapshots")
 
-            /* (Re)allocate memory for the file buffer, using callback if available */
-            if (file->fi_callbacks.image_realloc) {
-                if (NULL ==
-                    (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                                "unable to allocate memory block with callback")
-            } /* end if */
-            else {
-                if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
-            } /* end else */
-
-            if (file->eof < new_eof)
-                HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-            file->mem = x;
+            /* (Re)allocate memory for the file buffer */
+            if (H5FD__core_resize_mem(file, new_eof) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
 
             /* Update backing store, if using it and if closing */
             if (closing && (file->fd >= 0) && file->backing_store) {
@@ -1708,3 +2251,143 @@ H5FD__core_unlock(H5FD_t *_file)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_get_image_snapshot
+ *
+ * Purpose:     Takes a snapshot of the first SIZE bytes of a core VFD
+ *              file's image.  The snapshot shares the file's memory until
+ *              the file is next modified, at which point the file makes a
+ *              private copy of its whole image (copy-on-write).
+ *
+ *              The FLAGS_SIZE bytes at FLAGS_OFF in the image (the
+ *              superblock status flags) are cleared in the snapshot.  The
+ *              file keeps their real value aside while the memory is
+ *              shared, and puts it back in its private copy.  Images
+ *              owned by the application can't be changed, so a snapshot
+ *              of one whose flags are set is a copy instead.
+ *
+ *              The snapshot must be released with
+ *              H5FD_core_release_image_snapshot().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_core_get_image_snapshot(H5FD_t *_file, size_t size, size_t flags_off, size_t flags_size,
+                             const void **buf_ptr, void **snapshot)
+{
+    H5FD_core_t *         file      = (H5FD_core_t *)_file;
+    H5FD_core_snapshot_t *snap      = NULL;    /* New snapshot, if one is created */
+    hbool_t               flags_set = FALSE;   /* Whether the status flags are set */
+    size_t                u;                   /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+    HDassert(buf_ptr);
+    HDassert(snapshot);
+
+    /* Check arguments */
+    if (file->pub.driver_id != H5FD_CORE_g)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file image snapshots need the core VFD")
+    if (file->fi_callbacks.image_malloc || file->fi_callbacks.image_realloc || file->fi_callbacks.image_free)
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "file image snapshots can't use file image callbacks")
+    if (flags_off + flags_size > size || flags_size > sizeof(file->sflags))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bad status flags location")
+
+    /* Taking a snapshot never changes the file, so the whole image must
+     * already be in memory.  This is the case after the file is flushed.
+     */
+    if ((haddr_t)size > file->eof)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file image is larger than the file, flush the file first")
+
+    /* Reuse the memory already shared with other snapshots, where the
+     * status flags have already been cleared
+     */
+    if (NULL == file->snapshot)
+        for (u = 0; u < flags_size; u++)
+            if (file->mem[flags_off + u]) {
+                flags_set = TRUE;
+                break;
+            } /* end if */
+
+    if (flags_set && file->user_image) {
+        /* Make a private copy, with the status flags cleared */
+        if (NULL == (snap = (H5FD_core_snapshot_t *)H5MM_calloc(sizeof(H5FD_core_snapshot_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate snapshot")
+        snap->owns_mem = TRUE;
+        if (NULL == (snap->mem = (unsigned char *)H5MM_malloc(size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
+        H5MM_memcpy(snap->mem, file->mem, size);
+        HDmemset(snap->mem + flags_off, 0, flags_size);
+        snap->nrefs = 1;
+
+        *buf_ptr  = snap->mem;
+        *snapshot = snap;
+    } /* end if */
+    else {
+        /* Share the file's memory, the file holds a reference too */
+        if (NULL == file->snapshot) {
+            if (NULL == (snap = (H5FD_core_snapshot_t *)H5MM_calloc(sizeof(H5FD_core_snapshot_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate snapshot")
+            snap->mem       = file->mem;
+            snap->nrefs     = 1;
+            snap->owns_mem  = !file->user_image;
+            snap->use_mmap  = file->use_mmap;
+            snap->mmap_size = file->mmap_size;
+
+            /* Set the real status flags aside and clear them in the shared memory */
+            if (flags_set) {
+                H5MM_memcpy(file->sflags, file->mem + flags_off, flags_size);
+                HDmemset(file->mem + flags_off, 0, flags_size);
+                file->sflags_off  = flags_off;
+                file->sflags_size = flags_size;
+            } /* end if */
+
+            file->snapshot = snap;
+        } /* end if */
+        file->snapshot->nrefs++;
+
+        *buf_ptr  = file->mem;
+        *snapshot = file->snapshot;
+    } /* end else */
+
+done:
+    if (ret_value < 0 && snap && snap->nrefs == 0) {
+        if (snap->owns_mem && snap->mem)
+            H5MM_xfree(snap->mem);
+        H5MM_xfree(snap);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_get_image_snapshot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_release_image_snapshot
+ *
+ * Purpose:     Releases a snapshot taken with
+ *              H5FD_core_get_image_snapshot().  The snapshot may outlive
+ *              the file it was taken from.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_core_release_image_snapshot(void *snapshot)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(snapshot);
+
+    if (H5FD__core_snapshot_decr((H5FD_core_snapshot_t *)snapshot) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to release file image snapshot")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_release_image_snapshot() */
@@ -639,6 +639,97 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_dxpl_mpio_chunk_opt_ratio() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_dxpl_mpio_aggregation
+ *
+ * Purpose:     To set the number of aggregator processes and the file
+ *              domain alignment for two-phase collective I/O performed
+ *              within the library
+ *
+ * Note:        When NUM_AGGREGATORS is zero (the default), collective
+ *              I/O on contiguous datasets is passed to the MPI-IO
+ *              library, which does its own collective buffering.
+ *              Otherwise, the library routes the data of each collective
+ *              transfer to NUM_AGGREGATORS processes, each of which
+ *              owns a range of the file starting on a multiple of
+ *              ALIGNMENT (e.g. the file system stripe or page size), and
+ *              the aggregators access the file with a single large
+ *              independent request each.  This is meant for file systems
+ *              where the MPI-IO implementation does not aggregate well.
+ *
+ *              Each aggregator buffers its whole file range for the
+ *              transfer, so the number of aggregators should be chosen
+ *              so that the transfer size divided by NUM_AGGREGATORS fits
+ *              in memory.  All processes must use the same values.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_dxpl_mpio_aggregation(hid_t dxpl_id, unsigned num_aggregators, hsize_t alignment)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuh", dxpl_id, num_aggregators, alignment);
+
+    /* Check arguments */
+    if (dxpl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+    if (alignment == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "alignment must be positive")
+    if (NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a dxpl")
+
+    /* Set the values */
+    if (H5P_set(plist, H5D_XFER_MPIO_AGGR_NUM_NAME, &num_aggregators) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    if (H5P_set(plist, H5D_XFER_MPIO_AGGR_ALIGN_NAME, &alignment) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_dxpl_mpio_aggregation() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_dxpl_mpio_aggregation
+ *
+ * Purpose:     Queries the number of aggregator processes and the file
+ *              domain alignment for two-phase collective I/O performed
+ *              within the library
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_dxpl_mpio_aggregation(hid_t dxpl_id, unsigned *num_aggregators /*out*/, hsize_t *alignment /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", dxpl_id, num_aggregators, alignment);
+
+    if (NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a dxpl")
+
+    /* Get the values */
+    if (num_aggregators)
+        if (H5P_get(plist, H5D_XFER_MPIO_AGGR_NUM_NAME, num_aggregators) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    if (alignment)
+        if (H5P_get(plist, H5D_XFER_MPIO_AGGR_ALIGN_NAME, alignment) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_dxpl_mpio_aggregation() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_mpio_atomicity
  *
@@ -53,6 +53,9 @@ H5_DLL herr_t H5Pset_dxpl_mpio_collective_opt(hid_t dxpl_id, H5FD_mpio_collectiv
 H5_DLL herr_t H5Pset_dxpl_mpio_chunk_opt(hid_t dxpl_id, H5FD_mpio_chunk_opt_t opt_mode);
 H5_DLL herr_t H5Pset_dxpl_mpio_chunk_opt_num(hid_t dxpl_id, unsigned num_chunk_per_proc);
 H5_DLL herr_t H5Pset_dxpl_mpio_chunk_opt_ratio(hid_t dxpl_id, unsigned percent_num_proc_per_chunk);
+H5_DLL herr_t H5Pset_dxpl_mpio_aggregation(hid_t dxpl_id, unsigned num_aggregators, hsize_t alignment);
+H5_DLL herr_t H5Pget_dxpl_mpio_aggregation(hid_t dxpl_id, unsigned *num_aggregators /*out*/,
+                                           hsize_t *alignment /*out*/);
 #ifdef __cplusplus
 }
 #endif
@@ -141,6 +141,11 @@ H5_DLL herr_t  H5FD_set_base_addr(H5FD_t *file, haddr_t base_addr);
 H5_DLL haddr_t H5FD_get_base_addr(const H5FD_t *file);
 H5_DLL herr_t  H5FD_set_paged_aggr(H5FD_t *file, hbool_t paged);
 
+/* Function prototypes for core VFD file image snapshots */
+H5_DLL herr_t H5FD_core_get_image_snapshot(H5FD_t *file, size_t size, size_t flags_off, size_t flags_size,
+                                           const void **buf_ptr, void **snapshot);
+H5_DLL herr_t H5FD_core_release_image_snapshot(void *snapshot);
+
 /* Function prototypes for MPI based VFDs*/
 #ifdef H5_HAVE_PARALLEL
 /* General routines */
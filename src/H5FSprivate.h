@@ -205,6 +205,8 @@ H5_DLL herr_t  H5FS_free(H5F_t *f, H5FS_t *fspace, hbool_t free_file_space);
 /* Free space section routines */
 H5_DLL herr_t H5FS_sect_add(H5F_t *f, H5FS_t *fspace, H5FS_section_info_t *node, unsigned flags,
                             void *op_data);
+H5_DLL herr_t H5FS_sect_add_bulk(H5F_t *f, H5FS_t *fspace, size_t nsects, H5FS_section_info_t **sects,
+                                 unsigned flags, void *op_data);
 H5_DLL htri_t H5FS_sect_try_merge(H5F_t *f, H5FS_t *fspace, H5FS_section_info_t *sect, unsigned flags,
                                   void *op_data);
 H5_DLL htri_t H5FS_sect_try_extend(H5F_t *f, H5FS_t *fspace, haddr_t addr, hsize_t size,
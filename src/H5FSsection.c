@@ -74,6 +74,8 @@ static herr_t H5FS__sect_link_rest(H5FS_t *fspace, const H5FS_section_class_t *c
                                    unsigned flags);
 static herr_t H5FS__sect_link(H5FS_t *fspace, H5FS_section_info_t *sect, unsigned flags);
 static herr_t H5FS__sect_merge(H5FS_t *fspace, H5FS_section_info_t **sect, void *op_data);
+static herr_t H5FS__sect_add_real(H5FS_t *fspace, H5FS_section_info_t *sect, unsigned *flags, void *op_data);
+static int    H5FS__sect_cmp_addr(const void *_sect1, const void *_sect2);
 static htri_t H5FS__sect_find_node(H5FS_t *fspace, hsize_t request, H5FS_section_info_t **node);
 static herr_t H5FS__sect_serialize_size(H5FS_t *fspace);
 
@@ -1321,51 +1323,39 @@ done:
 } /* H5FS__sect_merge() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5FS_sect_add
+ * Function:    H5FS__sect_add_real
  *
- * Purpose:     Add a section of free space to the free list
+ * Purpose:     Add a section of free space to the free list, with the
+ *              section info already locked
  *
  * Return:      SUCCEED/FAIL
  *
- * Programmer:  Quincey Koziol
- *              Tuesday, March  7, 2006
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5FS_sect_add(H5F_t *f, H5FS_t *fspace, H5FS_section_info_t *sect, unsigned flags, void *op_data)
+static herr_t
+H5FS__sect_add_real(H5FS_t *fspace, H5FS_section_info_t *sect, unsigned *flags, void *op_data)
 {
-    H5FS_section_class_t *cls;                      /* Section's class */
-    hbool_t               sinfo_valid    = FALSE;   /* Whether the section info is valid */
-    hbool_t               sinfo_modified = FALSE;   /* Whether the section info was modified */
-    herr_t                ret_value      = SUCCEED; /* Return value */
-
-    FUNC_ENTER_NOAPI(FAIL)
+    H5FS_section_class_t *cls;                 /* Section's class */
+    herr_t                ret_value = SUCCEED; /* Return value */
 
-#ifdef H5FS_SINFO_DEBUG
-    HDfprintf(stderr, "%s: *sect = {%a, %Hu, %u, %s}\n", FUNC, sect->addr, sect->size, sect->type,
-              (sect->state == H5FS_SECT_LIVE ? "H5FS_SECT_LIVE" : "H5FS_SECT_SERIALIZED"));
-#endif /* H5FS_SINFO_DEBUG */
+    FUNC_ENTER_STATIC
 
     /* Check arguments. */
     HDassert(fspace);
+    HDassert(fspace->sinfo);
     HDassert(sect);
     HDassert(H5F_addr_defined(sect->addr));
     HDassert(sect->size);
-
-    /* Get a pointer to the section info */
-    if (H5FS__sinfo_lock(f, fspace, H5AC__NO_FLAGS_SET) < 0)
-        HGOTO_ERROR(H5E_FSPACE, H5E_CANTGET, FAIL, "can't get section info")
-    sinfo_valid = TRUE;
+    HDassert(flags);
 
     /* Call "add" section class callback, if there is one */
     cls = &fspace->sect_cls[sect->type];
     if (cls->add)
-        if ((*cls->add)(&sect, &flags, op_data) < 0)
+        if ((*cls->add)(&sect, flags, op_data) < 0)
             HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "'add' section class callback failed")
 
     /* Check for merging returned space with existing section node */
-    if (flags & H5FS_ADD_RETURNED_SPACE) {
+    if (*flags & H5FS_ADD_RETURNED_SPACE) {
 #ifdef H5FS_SINFO_DEBUG
         HDfprintf(stderr, "%s: Returning space\n", FUNC);
 #endif /* H5FS_SINFO_DEBUG */
@@ -1380,9 +1370,54 @@ H5FS_sect_add(H5F_t *f, H5FS_t *fspace, H5FS_section_info_t *sect, unsigned flag
      *  be NULL at this point - QAK)
      */
     if (sect)
-        if (H5FS__sect_link(fspace, sect, flags) < 0)
+        if (H5FS__sect_link(fspace, sect, *flags) < 0)
             HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "can't insert free space section into skip list")
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FS__sect_add_real() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FS_sect_add
+ *
+ * Purpose:     Add a section of free space to the free list
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ * Programmer:  Quincey Koziol
+ *              Tuesday, March  7, 2006
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FS_sect_add(H5F_t *f, H5FS_t *fspace, H5FS_section_info_t *sect, unsigned flags, void *op_data)
+{
+    hbool_t sinfo_valid    = FALSE;   /* Whether the section info is valid */
+    hbool_t sinfo_modified = FALSE;   /* Whether the section info was modified */
+    herr_t  ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+#ifdef H5FS_SINFO_DEBUG
+    HDfprintf(stderr, "%s: *sect = {%a, %Hu, %u, %s}\n", FUNC, sect->addr, sect->size, sect->type,
+              (sect->state == H5FS_SECT_LIVE ? "H5FS_SECT_LIVE" : "H5FS_SECT_SERIALIZED"));
+#endif /* H5FS_SINFO_DEBUG */
+
+    /* Check arguments. */
+    HDassert(fspace);
+    HDassert(sect);
+    HDassert(H5F_addr_defined(sect->addr));
+    HDassert(sect->size);
+
+    /* Get a pointer to the section info */
+    if (H5FS__sinfo_lock(f, fspace, H5AC__NO_FLAGS_SET) < 0)
+        HGOTO_ERROR(H5E_FSPACE, H5E_CANTGET, FAIL, "can't get section info")
+    sinfo_valid = TRUE;
+
+    /* Add the section */
+    if (H5FS__sect_add_real(fspace, sect, &flags, op_data) < 0)
+        HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "can't add section")
+
 #ifdef H5FS_SINFO_DEBUG
     HDfprintf(stderr, "%s: fspace->tot_space = %Hu\n", FUNC, fspace->tot_space);
 #endif /* H5FS_SINFO_DEBUG */
@@ -1406,6 +1441,121 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5FS_sect_add() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FS__sect_cmp_addr
+ *
+ * Purpose:     Compare two free space sections by address, for qsort()
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FS__sect_cmp_addr(const void *_sect1, const void *_sect2)
+{
+    const H5FS_section_info_t *sect1 = *(const H5FS_section_info_t *const *)_sect1;
+    const H5FS_section_info_t *sect2 = *(const H5FS_section_info_t *const *)_sect2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(sect1->addr, sect2->addr))
+} /* H5FS__sect_cmp_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FS_sect_add_bulk
+ *
+ * Purpose:     Add many sections of free space to the free list at once.
+ *
+ *              The sections are sorted by address and runs of adjoining
+ *              sections are merged with each other before being merged
+ *              with the sections already in the free list, so each run
+ *              costs a single merge and a single insertion.  The section
+ *              info is only locked once for the whole batch.
+ *
+ *              The sections are sorted in place in SECTS and are owned by
+ *              the free space manager afterwards.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FS_sect_add_bulk(H5F_t *f, H5FS_t *fspace, size_t nsects, H5FS_section_info_t **sects, unsigned flags,
+                   void *op_data)
+{
+    H5FS_section_info_t *run            = NULL;    /* Run of adjoining sections being merged */
+    hbool_t              sinfo_valid    = FALSE;   /* Whether the section info is valid */
+    hbool_t              sinfo_modified = FALSE;   /* Whether the section info was modified */
+    size_t               u;                        /* Local index variable */
+    herr_t               ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(fspace);
+    HDassert(sects || nsects == 0);
+
+    if (0 == nsects)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get a pointer to the section info */
+    if (H5FS__sinfo_lock(f, fspace, H5AC__NO_FLAGS_SET) < 0)
+        HGOTO_ERROR(H5E_FSPACE, H5E_CANTGET, FAIL, "can't get section info")
+    sinfo_valid = TRUE;
+
+    /* Sort the sections by address */
+    if (nsects > 1)
+        HDqsort(sects, nsects, sizeof(H5FS_section_info_t *), H5FS__sect_cmp_addr);
+
+    for (u = 0; u <= nsects; u++) {
+        H5FS_section_info_t *sect = (u < nsects) ? sects[u] : NULL; /* Next section */
+
+        /* Try to merge the next section into the current run */
+        if (run && sect) {
+            H5FS_section_class_t *cls = &fspace->sect_cls[run->type]; /* Run's class */
+            htri_t                status;                             /* Status value */
+
+            HDassert(H5F_addr_lt(run->addr, sect->addr));
+
+            /* Only merge here when the 'add' callback can't change the sections */
+            if (!cls->add && !fspace->sect_cls[sect->type].add &&
+                (!(cls->flags & H5FS_CLS_MERGE_SYM) || run->type == sect->type) && cls->can_merge) {
+                if ((status = (*cls->can_merge)(run, sect, op_data)) < 0)
+                    HGOTO_ERROR(H5E_FSPACE, H5E_CANTMERGE, FAIL, "can't check for merging sections")
+                if (status > 0) {
+                    /* Merge the next section into the run */
+                    HDassert(cls->merge);
+                    if ((*cls->merge)(&run, sect, op_data) < 0)
+                        HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "can't merge two sections")
+                    continue;
+                } /* end if */
+            }     /* end if */
+        }         /* end if */
+
+        /* Add the run to the free list and start a new one */
+        if (run) {
+            unsigned run_flags = flags; /* Flags for adding this run */
+
+            if (H5FS__sect_add_real(fspace, run, &run_flags, op_data) < 0)
+                HGOTO_ERROR(H5E_FSPACE, H5E_CANTINSERT, FAIL, "can't add section")
+            if (!(run_flags & (H5FS_ADD_DESERIALIZING | H5FS_PAGE_END_NO_ADD)))
+                sinfo_modified = TRUE;
+        } /* end if */
+        run = sect;
+    } /* end for */
+
+done:
+    /* Release the section info */
+    if (sinfo_valid && H5FS__sinfo_unlock(f, fspace, sinfo_modified) < 0)
+        HDONE_ERROR(H5E_FSPACE, H5E_CANTRELEASE, FAIL, "can't release section info")
+
+#ifdef H5FS_DEBUG_ASSERT
+    if (!(flags & (H5FS_ADD_DESERIALIZING | H5FS_ADD_SKIP_VALID)))
+        H5FS__assert(fspace);
+#endif /* H5FS_DEBUG_ASSERT */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FS_sect_add_bulk() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FS_sect_try_extend
  *
@@ -64,6 +64,13 @@ typedef struct H5F_olist_t {
     size_t max_nobjs;  /* Maximum # of IDs to put into array */
 } H5F_olist_t;
 
+/* Struct only used by functions H5F__compact and H5F__compact_cb */
+typedef struct H5F_compact_ud_t {
+    H5G_loc_t *root_loc;  /* Location of the root group */
+    hsize_t    max_bytes; /* Number of bytes to move, or 0 for no limit */
+    hsize_t    nmoved;    /* Number of bytes moved so far */
+} H5F_compact_ud_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -85,6 +92,7 @@ static herr_t H5F__build_actual_name(const H5F_t *f, const H5P_genplist_t *fapl,
                                      char ** /*out*/ actual_name);
 static herr_t H5F__flush_phase1(H5F_t *f);
 static herr_t H5F__flush_phase2(H5F_t *f, hbool_t closing);
+static herr_t H5F__compact_cb(hid_t group, const char *name, const H5L_info2_t *linfo, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -1317,6 +1325,16 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         if (H5AC_create(f, &(f->shared->mdc_initCacheCfg), &(f->shared->mdc_initCacheImageCfg)) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create metadata cache")
 
+        /* Set up recording of the metadata cache prefetch profile */
+        {
+            unsigned prefetch_profile_entries; /* Max. # of entries to record */
+
+            if (H5P_get(plist, H5F_ACS_MDC_PREFETCH_PROFILE_NAME, &prefetch_profile_entries) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache prefetch profile size")
+            if (H5C_set_prefetch_profile_config(f, f->shared->cache, prefetch_profile_entries) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't set up metadata cache prefetch profile")
+        } /* end block */
+
         /* Create the file's "open object" information */
         if (H5FO_create(f) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create open object data structure")
@@ -3179,6 +3197,169 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5F__get_file_image() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F__get_file_image_snapshot
+ *
+ * Purpose:     Private version of H5Fget_file_image_snapshot
+ *
+ * Return:      Success:        Size of the file image
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5F__get_file_image_snapshot(H5F_t *file, const void **buf_ptr, void **snapshot)
+{
+    H5FD_t *fd_ptr;         /* file driver */
+    haddr_t eoa;            /* End of file address */
+    ssize_t ret_value = -1; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (!file || !file->shared || !file->shared->lf)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, (-1), "file_id yields invalid file pointer")
+    fd_ptr = file->shared->lf;
+    HDassert(buf_ptr);
+    HDassert(snapshot);
+
+    /* The snapshot shares the core VFD's memory, which starts at address 0 */
+    if (H5FD_get_base_addr(fd_ptr) != 0)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, (-1), "file image snapshots need a zero base address")
+
+    /* Go get the actual file size */
+    if (HADDR_UNDEF == (eoa = H5FD_get_eoa(fd_ptr, H5FD_MEM_DEFAULT)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, (-1), "unable to get file size")
+
+    /* Take the snapshot, clearing the "status_flags" as H5F__get_file_image() does */
+    if (H5FD_core_get_image_snapshot(fd_ptr, (size_t)eoa,
+                                     (size_t)H5F_SUPER_STATUS_FLAGS_OFF(file->shared->sblock->super_vers),
+                                     (size_t)H5F_SUPER_STATUS_FLAGS_SIZE(file->shared->sblock->super_vers),
+                                     buf_ptr, snapshot) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, (-1), "unable to take file image snapshot")
+
+    ret_value = (ssize_t)eoa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__get_file_image_snapshot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact_cb
+ *
+ * Purpose:     Callback for H5F__compact, moving the raw data of each
+ *              dataset reached through a hard link.
+ *
+ * Return:      Success:        H5_ITER_CONT, or H5_ITER_STOP once the
+ *                              byte budget has been used up
+ *              Failure:        H5_ITER_ERROR
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__compact_cb(hid_t H5_ATTR_UNUSED group, const char *name, const H5L_info2_t *linfo, void *_udata)
+{
+    H5F_compact_ud_t *udata = (H5F_compact_ud_t *)_udata; /* User data */
+    H5G_loc_t         obj_loc;                            /* Location of object */
+    H5G_name_t        obj_path;                           /* Object's group hier. path */
+    H5O_loc_t         obj_oloc;                           /* Object's object location */
+    H5O_type_t        obj_type;                           /* Type of object */
+    H5D_t *           dset      = NULL;                   /* Dataset opened */
+    hbool_t           loc_found = FALSE;                  /* Whether the object location was found */
+    herr_t            ret_value = H5_ITER_CONT;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Soft and external links don't own any storage in this file */
+    if (H5L_TYPE_HARD != linfo->type)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Set up object location to fill in */
+    obj_loc.oloc = &obj_oloc;
+    obj_loc.path = &obj_path;
+    H5G_loc_reset(&obj_loc);
+
+    /* Find the object */
+    if (H5G_loc_find(udata->root_loc, name, &obj_loc) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_NOTFOUND, H5_ITER_ERROR, "object not found")
+    loc_found = TRUE;
+
+    if (H5O_obj_type(&obj_oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5_ITER_ERROR, "can't get object type")
+    if (H5O_TYPE_DATASET != obj_type)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Open the dataset, which takes over the location */
+    if (NULL == (dset = H5D_open(&obj_loc, H5P_DATASET_ACCESS_DEFAULT)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, H5_ITER_ERROR, "unable to open dataset")
+    loc_found = FALSE;
+
+    /* Move the dataset's raw data */
+    if (H5D_relocate_storage(dset, udata->max_bytes, &udata->nmoved) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTMOVE, H5_ITER_ERROR, "unable to move dataset storage")
+
+    if (udata->max_bytes > 0 && udata->nmoved >= udata->max_bytes)
+        ret_value = H5_ITER_STOP;
+
+done:
+    if (dset && H5D_close(dset) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CLOSEERROR, H5_ITER_ERROR, "unable to close dataset")
+    if (loc_found && H5G_loc_free(&obj_loc) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, H5_ITER_ERROR, "can't free location")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__compact_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__compact
+ *
+ * Purpose:     Private version of H5Fcompact.  Moves the raw data of the
+ *              datasets in the file into free space lower in the file,
+ *              until MAX_BYTES bytes have been moved (0 for no limit),
+ *              then flushes the file so that the space freed at the end
+ *              of the file is truncated away.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__compact(H5F_t *f, hsize_t max_bytes, hsize_t *bytes_moved)
+{
+    H5G_loc_t        root_loc;            /* Location of the root group */
+    H5F_compact_ud_t udata;               /* User data for callback */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(bytes_moved);
+
+    if (0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "file must be opened for writing")
+    if (H5F_INTENT(f) & H5F_ACC_SWMR_WRITE)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "can't move raw data while SWMR readers may see it")
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "not supported for files opened in parallel")
+
+    if (H5G_root_loc(f, &root_loc) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get location for root group")
+
+    /* Move the raw data of every dataset in the file */
+    udata.root_loc  = &root_loc;
+    udata.max_bytes = max_bytes;
+    udata.nmoved    = 0;
+    if (H5G_visit(&root_loc, ".", H5_INDEX_NAME, H5_ITER_INC, H5F__compact_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_BADITER, FAIL, "unable to move raw data")
+
+    /* Flush the file, releasing the space at the end of it */
+    if (udata.nmoved > 0 && H5F__flush(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+    *bytes_moved = udata.nmoved;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__compact() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F__get_info
  *
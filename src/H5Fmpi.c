@@ -357,6 +357,76 @@ done:
     FUNC_LEAVE_API(ret_value);
 } /* end H5Fget_mpi_atomicity() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mpi_sync_point_stats
+ *
+ * Purpose:     Retrieves the metadata cache sync point statistics of the
+ *              file, for this process
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_mpi_sync_point_stats(hid_t file_id, H5F_sync_point_stats_t *stats /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL);
+    H5TRACE2("e", "ix", file_id, stats);
+
+    /* Check args */
+    if (NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL stats pointer");
+
+    /* Get the file object */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier");
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_MPI_SYNC_POINT_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, stats) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get sync point statistics");
+
+done:
+    FUNC_LEAVE_API(ret_value);
+} /* end H5Fget_mpi_sync_point_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_mpi_sync_point_stats
+ *
+ * Purpose:     Resets the metadata cache sync point statistics of the
+ *              file, for this process
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_mpi_sync_point_stats(hid_t file_id)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL);
+    H5TRACE1("e", "i", file_id);
+
+    /* Get the file object */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier");
+
+    /* Reset the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_RESET_MPI_SYNC_POINT_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to reset sync point statistics");
+
+done:
+    FUNC_LEAVE_API(ret_value);
+} /* end H5Freset_mpi_sync_point_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_mpi_retrieve_comm
  *
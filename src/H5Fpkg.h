@@ -335,6 +335,12 @@ struct H5F_shared_t {
                                                   /* for metadata cache image, or   */
                                                   /* HADDR_UNDEF if no cache image. */
 
+    /* Batched free space release info */
+    unsigned                  mf_batch_depth;  /* Nesting depth of open free space batches */
+    size_t                    mf_batch_nsects; /* Number of sections held in the batch */
+    size_t                    mf_batch_nalloc; /* Number of section slots allocated */
+    struct H5MF_batch_sect_t *mf_batch;        /* Sections freed while the batch is open */
+
     /* Free-space aggregation info */
     unsigned   fs_aggr_merge[H5FD_MEM_NTYPES]; /* Flags for whether free space can merge with aggregator(s) */
     H5FD_mem_t fs_type_map[H5FD_MEM_NTYPES];   /* Mapping of "real" file space type into tracked type */
@@ -409,6 +415,8 @@ H5_DLL herr_t  H5F__dest(H5F_t *f, hbool_t flush);
 H5_DLL herr_t  H5F__flush(H5F_t *f);
 H5_DLL htri_t  H5F__is_hdf5(const char *name, hid_t fapl_id);
 H5_DLL ssize_t H5F__get_file_image(H5F_t *f, void *buf_ptr, size_t buf_len);
+H5_DLL ssize_t H5F__get_file_image_snapshot(H5F_t *f, const void **buf_ptr, void **snapshot);
+H5_DLL herr_t  H5F__compact(H5F_t *f, hsize_t max_bytes, hsize_t *bytes_moved);
 H5_DLL herr_t  H5F__get_info(H5F_t *f, H5F_info2_t *finfo);
 H5_DLL herr_t  H5F__format_convert(H5F_t *f);
 H5_DLL herr_t  H5F__start_swmr_write(H5F_t *f);
@@ -605,6 +605,8 @@ typedef struct H5F_t H5F_t;
                                  */
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME                                                            \
     "mdc_initCacheImageCfg" /* Initial metadata cache image creation configuration */
+#define H5F_ACS_MDC_PREFETCH_PROFILE_NAME                                                                    \
+    "mdc_prefetch_profile" /* Max. # of entries to record in the metadata cache prefetch profile */
 #define H5F_ACS_PAGE_BUFFER_SIZE_NAME "page_buffer_size" /* the maximum size for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME                                                               \
     "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
@@ -891,6 +893,7 @@ H5_DLL hbool_t            H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t            H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 H5_DLL hsize_t            H5F_get_alignment(const H5F_t *f);
 H5_DLL hsize_t            H5F_get_threshold(const H5F_t *f);
+H5_DLL hbool_t            H5F_paged_aggr(const H5F_t *f);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL H5P_coll_md_read_flag_t H5F_coll_md_read(const H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
@@ -98,6 +98,22 @@
  * desired flags.
  */
 #define H5F_MPIO_DEBUG_KEY "H5F_mpio_debug_key"
+
+//! <!-- [H5F_sync_point_stats_t_snip] -->
+/**
+ * Statistics about the metadata cache sync points run on a file opened
+ * with the MPI-IO driver, as seen by the calling process
+ */
+typedef struct H5F_sync_point_stats_t {
+    unsigned long long num_sync_points; /**< Number of sync points run                          */
+    size_t             last_entries;    /**< Entries written by this process, last sync point   */
+    size_t             last_blocks;     /**< Contiguous file blocks they were merged into       */
+    hsize_t            last_bytes;      /**< Bytes written by this process, last sync point     */
+    double             last_time;       /**< Seconds spent in the last sync point               */
+    hsize_t            total_bytes;     /**< Bytes written by this process, all sync points     */
+    double             total_time;      /**< Seconds spent in all sync points                   */
+} H5F_sync_point_stats_t;
+//! <!-- [H5F_sync_point_stats_t_snip] -->
 #endif /* H5_HAVE_PARALLEL */
 
 /**
@@ -964,6 +980,110 @@ H5_DLL herr_t H5Fincrement_filesize(hid_t file_id, hsize_t increment);
  *
  */
 H5_DLL ssize_t H5Fget_file_image(hid_t file_id, void *buf_ptr, size_t buf_len);
+/**
+ * \ingroup H5F
+ *
+ * \brief Takes a read-only snapshot of the image of an open file without
+ *        copying it
+ *
+ * \file_id
+ * \param[out] buf_ptr  Pointer to the start of the file image
+ * \param[out] snapshot Handle used to release the snapshot
+ *
+ * \return ssize_t
+ *
+ * \details H5Fget_file_image_snapshot() returns a pointer to the image of
+ *          a file opened with the Core (or Memory) virtual file driver,
+ *          sharing the driver's memory instead of copying it as
+ *          H5Fget_file_image() does. The return value is the length of the
+ *          image in bytes.
+ *
+ *          The image is copy-on-write: the next write to the file gives the
+ *          file a private copy of its whole image, so the contents at
+ *          \p buf_ptr do not change while the snapshot is held. Taking a
+ *          snapshot never changes the file, and all snapshots taken between
+ *          two writes share the same memory.
+ *
+ *          As with H5Fget_file_image(), the superblock status flags are
+ *          cleared in the image, so it can be opened like a closed file.
+ *
+ *          Unflushed changes are not part of the image. The function fails
+ *          if the file's allocated space has not been written out yet, so
+ *          call H5Fflush() before taking a snapshot of a file open for
+ *          writing.
+ *
+ *          The snapshot must be released with
+ *          H5Frelease_file_image_snapshot(). It may outlive the file.
+ *
+ * \note Files that use file image callbacks set with
+ *       H5Pset_file_image_callbacks() are not supported.
+ *
+ * \see H5Fget_file_image(), H5Pset_core_image()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL ssize_t H5Fget_file_image_snapshot(hid_t file_id, const void **buf_ptr, void **snapshot);
+/**
+ * \ingroup H5F
+ *
+ * \brief Releases a file image snapshot
+ *
+ * \param[in] snapshot Snapshot handle from H5Fget_file_image_snapshot()
+ *
+ * \return \herr_t
+ *
+ * \details H5Frelease_file_image_snapshot() releases a snapshot taken with
+ *          H5Fget_file_image_snapshot(). The image pointer returned with the
+ *          snapshot must not be used afterwards.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Frelease_file_image_snapshot(void *snapshot);
+/**
+ * \ingroup H5F
+ *
+ * \brief Moves dataset raw data toward the start of a file and releases
+ *        the space freed at its end
+ *
+ * \file_id
+ * \param[in]  max_bytes   Maximum number of bytes to move in this call, or
+ *                         0 for no limit
+ * \param[out] bytes_moved Number of bytes moved
+ *
+ * \return \herr_t
+ *
+ * \details H5Fcompact() reclaims free space in a file that is open for
+ *          writing, without copying the file as \c h5repack does. The raw
+ *          data chunks of chunked datasets and the raw data of contiguous
+ *          datasets are moved, highest address first, into free space
+ *          lower in the file that is tracked by the file's free-space
+ *          managers. Chunk indexes and layout messages are updated to the
+ *          new locations. The file is then flushed, which truncates the
+ *          space freed at its end.
+ *
+ *          The work can be done incrementally: at most \p max_bytes bytes
+ *          are moved in each call (the last chunk or contiguous dataset
+ *          moved may go over the limit). Call H5Fcompact() until
+ *          \p bytes_moved is 0 to compact the file completely.
+ *
+ *          Object headers and other metadata are not moved, as their
+ *          addresses identify objects. Free space can therefore only be
+ *          released up to the last metadata block in the file. Space is
+ *          only reused if the file tracks free space, which is the case
+ *          for the default file space strategy while the file stays open,
+ *          or across opens when free-space persistence is enabled with
+ *          H5Pset_file_space_strategy().
+ *
+ *          Chunks of datasets with the implicit chunk index, and data in
+ *          external files, are not moved. The function fails for files
+ *          opened for SWMR writing or with a parallel file driver.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Fcompact(hid_t file_id, hsize_t max_bytes, hsize_t *bytes_moved);
 /**
  * \ingroup MDC
  *
@@ -2170,6 +2290,49 @@ H5_DLL herr_t H5Fset_mpi_atomicity(hid_t file_id, hbool_t flag);
  * \todo Fix the reference!
  */
 H5_DLL herr_t H5Fget_mpi_atomicity(hid_t file_id, hbool_t *flag);
+/**
+ * \ingroup PH5F
+ *
+ * \brief Retrieves the metadata cache sync point statistics
+ *
+ * \file_id
+ * \param[out] stats Sync point statistics
+ * \returns \herr_t
+ *
+ * \details H5Fget_mpi_sync_point_stats() retrieves the statistics gathered
+ *          by the metadata cache of the file \p file_id about its sync
+ *          points, as seen by the calling process.
+ *
+ *          At each sync point, the dirty metadata entries that the calling
+ *          process must write are sorted by address, adjacent entries are
+ *          merged, and the result is written with a single collective
+ *          write. The \c last_* fields of \p stats describe the most recent
+ *          sync point; \c total_bytes and \c total_time accumulate over all
+ *          sync points since the file was opened or the statistics were
+ *          last reset.
+ *
+ *          \p stats is of type #H5F_sync_point_stats_t:
+ *          \snippet this H5F_sync_point_stats_t_snip
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Fget_mpi_sync_point_stats(hid_t file_id, H5F_sync_point_stats_t *stats);
+/**
+ * \ingroup PH5F
+ *
+ * \brief Resets the metadata cache sync point statistics
+ *
+ * \file_id
+ * \returns \herr_t
+ *
+ * \details H5Freset_mpi_sync_point_stats() resets the sync point
+ *          statistics of the file \p file_id for the calling process.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Freset_mpi_sync_point_stats(hid_t file_id);
 #endif /* H5_HAVE_PARALLEL */
 
 /* API Wrappers for async routines */
@@ -1024,6 +1024,29 @@ H5F_use_tmp_space(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->use_tmp_space)
 } /* end H5F_use_tmp_space() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_paged_aggr
+ *
+ * Purpose:  Quick and dirty routine to determine if paged aggregation
+ *           is used for file space management in this file.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   TRUE/FALSE on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_paged_aggr(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI((hbool_t)H5F_PAGED_AGGR(f))
+} /* end H5F_paged_aggr() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
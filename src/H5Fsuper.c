@@ -918,6 +918,29 @@ H5F__super_read(H5F_t *f, H5P_genplist_t *fa_plist, hbool_t initial_read)
             }     /* end if not marked "unknown" */
         }         /* end if */
 
+        /* Check for the extension having a 'metadata cache prefetch profile' message */
+        if ((status = H5O_msg_exists(&ext_loc, H5O_MDCP_MSG_ID)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_EXISTS, FAIL, "unable to read object header")
+        if (status) {
+            hbool_t    rw = ((rw_flags & H5AC__READ_ONLY_FLAG) == 0);
+            H5O_mdcp_t mdcp_msg;
+
+            /* As with the cache image, hand the profile to the metadata
+             * cache, which prefetches the listed entries on the next
+             * protect call if the file is opened read-only, or removes
+             * the (soon to be stale) profile if the file is opened R/W.
+             */
+            if (NULL == H5O_msg_read(&ext_loc, H5O_MDCP_MSG_ID, &mdcp_msg))
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL,
+                            "unable to get metadata cache prefetch profile message")
+            if (H5C_load_prefetch_profile_on_next_protect(f, mdcp_msg.nentries, mdcp_msg.entries, rw) < 0) {
+                H5O_msg_reset(H5O_MDCP_MSG_ID, &mdcp_msg);
+                HGOTO_ERROR(H5E_FILE, H5E_CANTLOAD, FAIL,
+                            "call to H5C_load_prefetch_profile_on_next_protect failed")
+            } /* end if */
+            H5O_msg_reset(H5O_MDCP_MSG_ID, &mdcp_msg);
+        } /* end if */
+
         /* Check for the extension having a 'metadata cache image' message */
         if ((status = H5O_msg_exists(&ext_loc, H5O_MDCI_MSG_ID)) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_EXISTS, FAIL, "unable to read object header")
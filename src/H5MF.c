@@ -38,6 +38,7 @@
 #include "H5Fpkg.h"      /* File access				*/
 #include "H5FSpkg.h"     /* File free space                      */
 #include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5MMprivate.h" /* Memory management			*/
 #include "H5MFpkg.h"     /* File memory management		*/
 #include "H5VMprivate.h" /* Vectors and arrays 			*/
 
@@ -111,6 +112,11 @@ static herr_t H5MF__close_delete_fstype(H5F_t *f, H5F_mem_page_t type);
 /* Callbacks */
 static herr_t H5MF__sects_cb(H5FS_section_info_t *_sect, void *_udata);
 
+/* Batched free space release routines */
+static herr_t H5MF__batch_add(H5F_t *f, H5FD_mem_t alloc_type, H5F_mem_page_t fs_type,
+                              H5MF_free_section_t *node);
+static int    H5MF__batch_cmp(const void *_sect1, const void *_sect2);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -1194,8 +1200,14 @@ H5MF_xfree(H5F_t *f, H5FD_mem_t alloc_type, haddr_t addr, hsize_t size)
         HDfprintf(stderr, "%s: Before H5FS_sect_add()\n", FUNC);
 #endif /* H5MF_ALLOC_DEBUG_MORE */
 
-        /* Add to the free space for the file */
-        if (H5MF__add_sect(f, alloc_type, f->shared->fs_man[fs_type], node) < 0)
+        /* Defer the section while a free space batch is open, otherwise
+         *  add it to the free space for the file now
+         */
+        if (f->shared->mf_batch_depth > 0 && !H5F_PAGED_AGGR(f)) {
+            if (H5MF__batch_add(f, alloc_type, fs_type, node) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't add section to free space batch")
+        } /* end if */
+        else if (H5MF__add_sect(f, alloc_type, f->shared->fs_man[fs_type], node) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't add section to file free space")
         node = NULL;
 
@@ -1241,6 +1253,216 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5MF_xfree() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_free_batch_begin
+ *
+ * Purpose:     Start a batch of file space releases.
+ *
+ *              Sections freed with H5MF_xfree() while the batch is open
+ *              are held back and handed to the free space managers all
+ *              together by H5MF_free_batch_end(), so that adjoining
+ *              sections are merged with each other first and each free
+ *              space manager's section info is only locked once.
+ *              Batches may be nested; the sections are released when the
+ *              outermost batch ends.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_free_batch_begin(H5F_t *f)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->mf_batch_depth++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5MF_free_batch_begin() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__batch_add
+ *
+ * Purpose:     Hold a freed section in the file's open free space batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__batch_add(H5F_t *f, H5FD_mem_t alloc_type, H5F_mem_page_t fs_type, H5MF_free_section_t *node)
+{
+    H5F_shared_t *f_sh      = f->shared; /* Shared file info */
+    herr_t        ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f_sh->mf_batch_depth > 0);
+    HDassert(node);
+
+    /* Make room for the section */
+    if (f_sh->mf_batch_nsects == f_sh->mf_batch_nalloc) {
+        size_t             new_nalloc = MAX(64, 2 * f_sh->mf_batch_nalloc); /* New number of slots */
+        H5MF_batch_sect_t *new_batch;                                       /* Resized batch array */
+
+        if (NULL == (new_batch = (H5MF_batch_sect_t *)H5MM_realloc(f_sh->mf_batch,
+                                                                   new_nalloc * sizeof(H5MF_batch_sect_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate free space batch")
+        f_sh->mf_batch        = new_batch;
+        f_sh->mf_batch_nalloc = new_nalloc;
+    } /* end if */
+
+    f_sh->mf_batch[f_sh->mf_batch_nsects].alloc_type = alloc_type;
+    f_sh->mf_batch[f_sh->mf_batch_nsects].fs_type    = fs_type;
+    f_sh->mf_batch[f_sh->mf_batch_nsects].node       = node;
+    f_sh->mf_batch_nsects++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__batch_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__batch_cmp
+ *
+ * Purpose:     Compare two batched sections by free space type, allocation
+ *              type and address, for qsort()
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5MF__batch_cmp(const void *_sect1, const void *_sect2)
+{
+    const H5MF_batch_sect_t *sect1 = (const H5MF_batch_sect_t *)_sect1;
+    const H5MF_batch_sect_t *sect2 = (const H5MF_batch_sect_t *)_sect2;
+    int                      ret_value;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (sect1->fs_type != sect2->fs_type)
+        ret_value = (sect1->fs_type < sect2->fs_type) ? -1 : 1;
+    else if (sect1->alloc_type != sect2->alloc_type)
+        ret_value = (sect1->alloc_type < sect2->alloc_type) ? -1 : 1;
+    else
+        ret_value = H5F_addr_cmp(sect1->node->sect_info.addr, sect2->node->sect_info.addr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__batch_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_free_batch_end
+ *
+ * Purpose:     End a batch of file space releases, adding the sections
+ *              freed during the outermost batch to the free space managers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_free_batch_end(H5F_t *f)
+{
+    H5F_shared_t *        f_sh;                      /* Shared file info */
+    H5FS_section_info_t **sects     = NULL;          /* Sections of one group */
+    H5AC_ring_t           orig_ring = H5AC_RING_INV; /* Original ring value */
+    size_t                u, v;                      /* Local index variables */
+    herr_t                ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__FREESPACE_TAG, FAIL)
+
+    HDassert(f);
+    f_sh = f->shared;
+    HDassert(f_sh->mf_batch_depth > 0);
+
+    /* Only release the sections when the outermost batch ends */
+    if (--f_sh->mf_batch_depth > 0 || 0 == f_sh->mf_batch_nsects)
+        HGOTO_DONE(SUCCEED)
+
+    /* Group the sections by free space manager and allocation type */
+    HDqsort(f_sh->mf_batch, f_sh->mf_batch_nsects, sizeof(H5MF_batch_sect_t), H5MF__batch_cmp);
+
+    if (NULL == (sects = (H5FS_section_info_t **)H5MM_malloc(f_sh->mf_batch_nsects *
+                                                              sizeof(H5FS_section_info_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate section array")
+
+    for (u = 0; u < f_sh->mf_batch_nsects; u = v) {
+        H5FD_mem_t     alloc_type = f_sh->mf_batch[u].alloc_type; /* Allocation type of group */
+        H5F_mem_page_t fs_type    = f_sh->mf_batch[u].fs_type;    /* Free space type of group */
+        H5MF_sect_ud_t udata;                                     /* User data for callbacks */
+        H5AC_ring_t    fsm_ring;                                  /* Ring of FSM */
+        size_t         w;                                         /* Local index variable */
+
+        /* Find the end of this group */
+        for (v = u; v < f_sh->mf_batch_nsects && f_sh->mf_batch[v].fs_type == fs_type &&
+                    f_sh->mf_batch[v].alloc_type == alloc_type;
+             v++)
+            ;
+
+        /* The free space manager may have gone away while the batch was open */
+        if (!f_sh->fs_man[fs_type]) {
+            if (f_sh->fs_state[fs_type] == H5F_FS_STATE_DELETING || !H5F_HAVE_FREE_SPACE_MANAGER(f)) {
+                /* Drop the sections on the floor, as H5MF_xfree() would */
+                for (w = u; w < v; w++) {
+                    if (H5MF__sect_free((H5FS_section_info_t *)f_sh->mf_batch[w].node) < 0)
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't free section node")
+                    f_sh->mf_batch[w].node = NULL;
+                } /* end for */
+                continue;
+            } /* end if */
+            if (H5MF__start_fstype(f, fs_type) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't initialize file free space")
+        } /* end if */
+
+        /* Construct user data for callbacks */
+        udata.f                     = f;
+        udata.alloc_type            = alloc_type;
+        udata.allow_sect_absorb     = TRUE;
+        udata.allow_eoa_shrink_only = FALSE;
+
+        /* Set the ring type in the API context */
+        if (H5MF__fsm_is_self_referential(f_sh, f_sh->fs_man[fs_type]))
+            fsm_ring = H5AC_RING_MDFSM;
+        else
+            fsm_ring = H5AC_RING_RDFSM;
+        H5AC_set_ring(fsm_ring, (orig_ring == H5AC_RING_INV) ? &orig_ring : NULL);
+
+        /* Hand the sections of this group over to the free space manager */
+        for (w = u; w < v; w++) {
+            sects[w - u]           = (H5FS_section_info_t *)f_sh->mf_batch[w].node;
+            f_sh->mf_batch[w].node = NULL;
+        } /* end for */
+
+        /* Add the sections, merging adjoining ones first */
+        if (H5FS_sect_add_bulk(f, f_sh->fs_man[fs_type], v - u, sects, H5FS_ADD_RETURNED_SPACE, &udata) <
+            0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't add sections to file free space")
+    } /* end for */
+
+done:
+    /* Reset the ring in the API context */
+    if (orig_ring != H5AC_RING_INV)
+        H5AC_set_ring(orig_ring, NULL);
+
+    /* Release the batch once the outermost batch has ended */
+    if (0 == f_sh->mf_batch_depth && f_sh->mf_batch) {
+        /* Free any sections that were not handed to a free space manager */
+        for (u = 0; u < f_sh->mf_batch_nsects; u++)
+            if (f_sh->mf_batch[u].node &&
+                H5MF__sect_free((H5FS_section_info_t *)f_sh->mf_batch[u].node) < 0)
+                HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't free section node")
+        f_sh->mf_batch        = (H5MF_batch_sect_t *)H5MM_xfree(f_sh->mf_batch);
+        f_sh->mf_batch_nsects = 0;
+        f_sh->mf_batch_nalloc = 0;
+    } /* end if */
+    H5MM_xfree(sects);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5MF_free_batch_end() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5MF_try_extend
  *
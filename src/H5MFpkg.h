@@ -154,6 +154,13 @@ typedef struct H5MF_sect_ud_t {
     H5F_blk_aggr_t *   aggr;   /* Aggregator block to operate on */
 } H5MF_sect_ud_t;
 
+/* Section freed while a free space batch is open */
+typedef struct H5MF_batch_sect_t {
+    H5FD_mem_t           alloc_type; /* Type of memory the section was allocated for */
+    H5F_mem_page_t       fs_type;    /* Free space type of the section */
+    H5MF_free_section_t *node;       /* Free space section */
+} H5MF_batch_sect_t;
+
 /* Information about the current free-space manager to use */
 typedef struct H5MF_fs_t {
     H5F_fs_state_t *fs_state;
@@ -0,0 +1,330 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Ocache_profile.c
+ *
+ * Purpose:     A message listing the address, length and type of the
+ *		metadata cache entries loaded early in a previous R/W
+ *		open of the file, used to prefetch those entries when
+ *		the file is next opened read only.
+ *
+ * 		The mdcp_msg only appears in the superblock extension.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "H5Omodule.h" /* This source code file is part of the H5O module */
+
+#include "H5private.h"   /* Generic Functions                     */
+#include "H5Eprivate.h"  /* Error handling                        */
+#include "H5FLprivate.h" /* Free Lists                            */
+#include "H5MMprivate.h" /* Memory management                     */
+#include "H5Opkg.h"      /* Object headers                        */
+
+/* Callbacks for message class */
+static void *H5O__mdcp_decode(H5F_t *f, H5O_t *open_oh, unsigned mesg_flags, unsigned *ioflags, size_t p_size,
+                              const uint8_t *p);
+static herr_t H5O__mdcp_encode(H5F_t *f, hbool_t disable_shared, uint8_t *p, const void *_mesg);
+static void * H5O__mdcp_copy(const void *_mesg, void *_dest);
+static size_t H5O__mdcp_size(const H5F_t *f, hbool_t disable_shared, const void *_mesg);
+static herr_t H5O__mdcp_reset(void *_mesg);
+static herr_t H5O__mdcp_free(void *mesg);
+static herr_t H5O__mdcp_debug(H5F_t *f, const void *_mesg, FILE *stream, int indent, int fwidth);
+
+/* This message derives from H5O message class */
+const H5O_msg_class_t H5O_MSG_MDCP[1] = {{
+    H5O_MDCP_MSG_ID,    /* message id number              */
+    "mdcp",             /* message name for debugging     */
+    sizeof(H5O_mdcp_t), /* native message size            */
+    0,                  /* messages are sharable?         */
+    H5O__mdcp_decode,   /* decode message                 */
+    H5O__mdcp_encode,   /* encode message                 */
+    H5O__mdcp_copy,     /* copy method                    */
+    H5O__mdcp_size,     /* size of mdc profile message    */
+    H5O__mdcp_reset,    /* reset method                   */
+    H5O__mdcp_free,     /* free method                    */
+    NULL,               /* file delete method             */
+    NULL,               /* link method                    */
+    NULL,               /* set share method               */
+    NULL,               /* can share method               */
+    NULL,               /* pre copy native value to file  */
+    NULL,               /* copy native value to file      */
+    NULL,               /* post copy native value to file */
+    NULL,               /* get creation index             */
+    NULL,               /* set creation index             */
+    H5O__mdcp_debug     /* debugging                      */
+}};
+
+/* Only one version of the metadata cache prefetch profile message at present */
+#define H5O_MDCP_VERSION_0 0
+
+/* Size of an encoded profile entry */
+#define H5O_MDCP_ENTRY_SIZE(f) ((size_t)(1 + H5F_SIZEOF_ADDR(f) + H5F_SIZEOF_SIZE(f)))
+
+/* Declare the free list for H5O_mdcp_t's */
+H5FL_DEFINE_STATIC(H5O_mdcp_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_decode
+ *
+ * Purpose:     Decode a metadata cache prefetch profile message and return
+ * 		a pointer to a newly allocated H5O_mdcp_t struct.
+ *
+ * Return:      Success:        Ptr to new message in native struct.
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__mdcp_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, unsigned H5_ATTR_UNUSED mesg_flags,
+                 unsigned H5_ATTR_UNUSED *ioflags, size_t p_size, const uint8_t *p)
+{
+    H5O_mdcp_t *mesg = NULL;      /* Native message        */
+    uint32_t    nentries;         /* # of profile entries  */
+    size_t      u;                /* Local index variable  */
+    void *      ret_value = NULL; /* Return value          */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(p);
+
+    /* Version of message */
+    if (*p++ != H5O_MDCP_VERSION_0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "bad version number for message")
+
+    /* Number of entries */
+    UINT32DECODE(p, nentries);
+    if (p_size < (size_t)(1 + 4) + (size_t)nentries * H5O_MDCP_ENTRY_SIZE(f))
+        HGOTO_ERROR(H5E_OHDR, H5E_BADSIZE, NULL, "metadata cache prefetch profile message is truncated")
+
+    /* Allocate space for message */
+    if (NULL == (mesg = H5FL_CALLOC(H5O_mdcp_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
+                    "memory allocation failed for metadata cache prefetch profile message")
+    if (nentries > 0 && NULL == (mesg->entries = (H5C_prefetch_entry_t *)H5MM_malloc(
+                                     (size_t)nentries * sizeof(H5C_prefetch_entry_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for profile entries")
+    mesg->nentries = (size_t)nentries;
+
+    /* Decode the entries */
+    for (u = 0; u < mesg->nentries; u++) {
+        mesg->entries[u].type_id = (int32_t)*p++;
+        H5F_addr_decode(f, &p, &(mesg->entries[u].addr));
+        H5F_DECODE_LENGTH(f, p, mesg->entries[u].size);
+    } /* end for */
+
+    /* Set return value */
+    ret_value = (void *)mesg;
+
+done:
+    if (!ret_value && mesg) {
+        H5MM_xfree(mesg->entries);
+        mesg = H5FL_FREE(H5O_mdcp_t, mesg);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__mdcp_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_encode
+ *
+ * Purpose:     Encode metadata cache prefetch profile message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__mdcp_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p, const void *_mesg)
+{
+    const H5O_mdcp_t *mesg = (const H5O_mdcp_t *)_mesg;
+    size_t            u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(p);
+    HDassert(mesg);
+    HDassert(mesg->nentries <= H5AC__MAX_PREFETCH_PROFILE_ENTRIES);
+
+    /* encode */
+    *p++ = H5O_MDCP_VERSION_0;
+    UINT32ENCODE(p, mesg->nentries);
+    for (u = 0; u < mesg->nentries; u++) {
+        HDassert(mesg->entries[u].type_id >= 0 && mesg->entries[u].type_id <= UCHAR_MAX);
+        *p++ = (uint8_t)mesg->entries[u].type_id;
+        H5F_addr_encode(f, &p, mesg->entries[u].addr);
+        H5F_ENCODE_LENGTH(f, p, mesg->entries[u].size);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__mdcp_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_copy
+ *
+ * Purpose:     Copies a message from _MESG to _DEST, allocating _DEST if
+ *              necessary.
+ *
+ * Return:      Success:        Ptr to _DEST
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__mdcp_copy(const void *_mesg, void *_dest)
+{
+    const H5O_mdcp_t *    mesg      = (const H5O_mdcp_t *)_mesg;
+    H5O_mdcp_t *          dest      = (H5O_mdcp_t *)_dest;
+    H5C_prefetch_entry_t *entries   = NULL; /* Copy of the profile entries */
+    void *                ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(mesg);
+    if (mesg->nentries > 0) {
+        if (NULL == (entries = (H5C_prefetch_entry_t *)H5MM_malloc(mesg->nentries *
+                                                                  sizeof(H5C_prefetch_entry_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+        H5MM_memcpy(entries, mesg->entries, mesg->nentries * sizeof(H5C_prefetch_entry_t));
+    } /* end if */
+    if (!dest && NULL == (dest = H5FL_MALLOC(H5O_mdcp_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* copy */
+    dest->nentries = mesg->nentries;
+    dest->entries  = entries;
+
+    /* Set return value */
+    ret_value = dest;
+
+done:
+    if (!ret_value)
+        H5MM_xfree(entries);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__mdcp_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_size
+ *
+ * Purpose:     Returns the size of the raw message in bytes not counting
+ *              the message type or size fields, but only the data fields.
+ *              This function doesn't take into account alignment.
+ *
+ * Return:      Success:        Message data size in bytes without alignment.
+ *
+ *              Failure:        zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5O__mdcp_size(const H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, const void *_mesg)
+{
+    const H5O_mdcp_t *mesg      = (const H5O_mdcp_t *)_mesg;
+    size_t            ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = (size_t)(1 +                                       /* Version number    */
+                         4 +                                       /* Number of entries */
+                         mesg->nentries * H5O_MDCP_ENTRY_SIZE(f)); /* Profile entries   */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__mdcp_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_reset
+ *
+ * Purpose:     Frees resources within a metadata cache prefetch profile
+ *              message, but doesn't free the message itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__mdcp_reset(void *_mesg)
+{
+    H5O_mdcp_t *mesg = (H5O_mdcp_t *)_mesg;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mesg);
+
+    mesg->entries  = (H5C_prefetch_entry_t *)H5MM_xfree(mesg->entries);
+    mesg->nentries = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__mdcp_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_free
+ *
+ * Purpose:     Free the message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__mdcp_free(void *mesg)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mesg);
+
+    mesg = H5FL_FREE(H5O_mdcp_t, mesg);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__mdcp_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__mdcp_debug
+ *
+ * Purpose:     Prints debugging info.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__mdcp_debug(H5F_t H5_ATTR_UNUSED *f, const void *_mesg, FILE *stream, int indent, int fwidth)
+{
+    const H5O_mdcp_t *mdcp = (const H5O_mdcp_t *)_mesg;
+    size_t            u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* check args */
+    HDassert(f);
+    HDassert(mdcp);
+    HDassert(stream);
+    HDassert(indent >= 0);
+    HDassert(fwidth >= 0);
+
+    HDfprintf(stream, "%*s%-*s %zu\n", indent, "", fwidth, "Number of profile entries:", mdcp->nentries);
+
+    for (u = 0; u < mdcp->nentries; u++)
+        HDfprintf(stream, "%*s%-*s type %d, address %" PRIuHADDR ", %zu bytes\n", indent + 3, "",
+                  MAX(0, fwidth - 3), "Entry:", (int)mdcp->entries[u].type_id, mdcp->entries[u].addr,
+                  mdcp->entries[u].size);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__mdcp_debug() */
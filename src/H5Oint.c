@@ -120,7 +120,8 @@ const H5O_msg_class_t *const H5O_msg_class_g[] = {
     H5O_MSG_REFCOUNT,    /*0x0016 Object's ref. count             */
     H5O_MSG_FSINFO,      /*0x0017 Free-space manager info         */
     H5O_MSG_MDCI,        /*0x0018 Metadata cache image            */
-    H5O_MSG_UNKNOWN      /*0x0019 Placeholder for unknown message */
+    H5O_MSG_MDCP,        /*0x0019 Metadata cache prefetch profile */
+    H5O_MSG_UNKNOWN      /*0x001a Placeholder for unknown message */
 };
 
 /* Format version bounds for object header */
@@ -1545,7 +1546,8 @@ H5O_delete(H5F_t *f, haddr_t addr)
     H5O_loc_t loc;                           /* Object location for object to delete */
     unsigned  oh_flags = H5AC__NO_FLAGS_SET; /* Flags for unprotecting object header */
     hbool_t   corked;
-    herr_t    ret_value = SUCCEED; /* Return value */
+    hbool_t   batch_open = FALSE;   /* Whether a free space batch is open */
+    herr_t    ret_value  = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI_TAG(addr, FAIL)
 
@@ -1553,6 +1555,14 @@ H5O_delete(H5F_t *f, haddr_t addr)
     HDassert(f);
     HDassert(H5F_addr_defined(addr));
 
+    /* Release the file space of the object and everything it owns in one
+     *  batch, so that adjoining blocks are merged before reaching the free
+     *  space manager
+     */
+    if (H5MF_free_batch_begin(f) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to start free space batch")
+    batch_open = TRUE;
+
     /* Set up the object location */
     loc.file         = f;
     loc.addr         = addr;
@@ -1579,6 +1589,8 @@ H5O_delete(H5F_t *f, haddr_t addr)
 done:
     if (oh && H5O_unprotect(&loc, oh, oh_flags) < 0)
         HDONE_ERROR(H5E_OHDR, H5E_PROTECT, FAIL, "unable to release object header")
+    if (batch_open && H5MF_free_batch_end(f) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTFREE, FAIL, "unable to end free space batch")
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O_delete() */
@@ -30,7 +30,7 @@
 #define H5O_NCHUNKS 2 /*initial number of chunks	     */
 #define H5O_MIN_SIZE                                                                                         \
     22 /* Min. obj header data size (must be big enough for a message prefix and a continuation message) */
-#define H5O_MSG_TYPES         26    /* # of types of messages            */
+#define H5O_MSG_TYPES         27    /* # of types of messages            */
 #define H5O_MAX_CRT_ORDER_IDX 65535 /* Max. creation order index value   */
 
 /* Versions of object header structure */
@@ -523,7 +523,10 @@ H5_DLLVAR const H5O_msg_class_t H5O_MSG_FSINFO[1];
 /* Metadata Cache Image message. (0x0018) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_MDCI[1];
 
-/* Placeholder for unknown message. (0x0019) */
+/* Metadata Cache Prefetch Profile message. (0x0019) */
+H5_DLLVAR const H5O_msg_class_t H5O_MSG_MDCP[1];
+
+/* Placeholder for unknown message. (0x001a) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_UNKNOWN[1];
 
 /*
@@ -231,7 +231,8 @@ typedef struct H5O_copy_t {
 #define H5O_REFCOUNT_ID    0x0016 /* Reference count message.  */
 #define H5O_FSINFO_ID      0x0017 /* File space info message.  */
 #define H5O_MDCI_MSG_ID    0x0018 /* Metadata Cache Image Message */
-#define H5O_UNKNOWN_ID     0x0019 /* Placeholder message ID for unknown message.  */
+#define H5O_MDCP_MSG_ID    0x0019 /* Metadata Cache Prefetch Profile Message */
+#define H5O_UNKNOWN_ID     0x001a /* Placeholder message ID for unknown message.  */
 /* (this should never exist in a file) */
 /*
  * Note: Must increment H5O_MSG_TYPES in H5Opkg.h and update H5O_msg_class_g
@@ -241,7 +242,7 @@ typedef struct H5O_copy_t {
  *
  * (this should never exist in a file)
  */
-#define H5O_BOGUS_INVALID_ID 0x001a /* "Bogus invalid" Message.  */
+#define H5O_BOGUS_INVALID_ID 0x001b /* "Bogus invalid" Message.  */
 
 /* Shared object message types.
  * Shared objects can be committed, in which case the shared message contains
@@ -865,6 +866,17 @@ typedef struct H5O_mdci_t {
     hsize_t size; /* size of MDC image block    */
 } H5O_mdci_t;
 
+/*
+ * Metadata Cache Prefetch Profile Message.
+ * Contains the address, length and type of the metadata cache entries
+ * loaded early in a previous R/W open of the file.
+ * (Data structure in memory)
+ */
+typedef struct H5O_mdcp_t {
+    size_t                nentries; /* number of entries in the profile */
+    H5C_prefetch_entry_t *entries;  /* array of profile entries         */
+} H5O_mdcp_t;
+
 /* Typedef for "application" iteration operations */
 typedef herr_t (*H5O_operator_t)(const void *mesg /*in*/, unsigned idx, void *operator_data /*in,out*/);
 
@@ -121,6 +121,14 @@
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEF  H5D_MULTI_CHUNK_IO_COL_THRESHOLD
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_ENC  H5P__encode_unsigned
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEC  H5P__decode_unsigned
+#define H5D_XFER_MPIO_AGGR_NUM_SIZE        sizeof(unsigned)
+#define H5D_XFER_MPIO_AGGR_NUM_DEF         0
+#define H5D_XFER_MPIO_AGGR_NUM_ENC         H5P__encode_unsigned
+#define H5D_XFER_MPIO_AGGR_NUM_DEC         H5P__decode_unsigned
+#define H5D_XFER_MPIO_AGGR_ALIGN_SIZE      sizeof(hsize_t)
+#define H5D_XFER_MPIO_AGGR_ALIGN_DEF       1
+#define H5D_XFER_MPIO_AGGR_ALIGN_ENC       H5P__encode_hsize_t
+#define H5D_XFER_MPIO_AGGR_ALIGN_DEC       H5P__decode_hsize_t
 /* Definitions for chunk opt mode property. */
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_SIZE sizeof(H5D_mpio_actual_chunk_opt_mode_t)
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_DEF  H5D_MPIO_NO_CHUNK_OPTIMIZATION
@@ -253,6 +261,8 @@ static const H5FD_mpio_chunk_opt_t      H5D_def_mpio_chunk_opt_mode_g      = H5D
 static const H5FD_mpio_collective_opt_t H5D_def_mpio_collective_opt_mode_g = H5D_XFER_MPIO_COLLECTIVE_OPT_DEF;
 static const unsigned                   H5D_def_mpio_chunk_opt_num_g       = H5D_XFER_MPIO_CHUNK_OPT_NUM_DEF;
 static const unsigned                   H5D_def_mpio_chunk_opt_ratio_g = H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEF;
+static const unsigned                   H5D_def_mpio_aggr_num_g        = H5D_XFER_MPIO_AGGR_NUM_DEF;
+static const hsize_t                    H5D_def_mpio_aggr_align_g      = H5D_XFER_MPIO_AGGR_ALIGN_DEF;
 static const H5D_mpio_actual_chunk_opt_mode_t H5D_def_mpio_actual_chunk_opt_mode_g =
     H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_DEF;
 static const H5D_mpio_actual_io_mode_t      H5D_def_mpio_actual_io_mode_g = H5D_MPIO_ACTUAL_IO_MODE_DEF;
@@ -367,6 +377,14 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            H5D_XFER_MPIO_CHUNK_OPT_RATIO_ENC, H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEC, NULL, NULL,
                            NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    if (H5P__register_real(pclass, H5D_XFER_MPIO_AGGR_NUM_NAME, H5D_XFER_MPIO_AGGR_NUM_SIZE,
+                           &H5D_def_mpio_aggr_num_g, NULL, NULL, NULL, H5D_XFER_MPIO_AGGR_NUM_ENC,
+                           H5D_XFER_MPIO_AGGR_NUM_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    if (H5P__register_real(pclass, H5D_XFER_MPIO_AGGR_ALIGN_NAME, H5D_XFER_MPIO_AGGR_ALIGN_SIZE,
+                           &H5D_def_mpio_aggr_align_g, NULL, NULL, NULL, H5D_XFER_MPIO_AGGR_ALIGN_ENC,
+                           H5D_XFER_MPIO_AGGR_ALIGN_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
     /* Register the chunk optimization mode property. */
     /* (Note: this property should not have an encode/decode callback -QAK) */
@@ -260,6 +260,11 @@
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_ENC  H5P__facc_cache_image_config_enc
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_DEC  H5P__facc_cache_image_config_dec
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_CMP  H5P__facc_cache_image_config_cmp
+/* Definition for the metadata cache prefetch profile size */
+#define H5F_ACS_MDC_PREFETCH_PROFILE_SIZE sizeof(unsigned)
+#define H5F_ACS_MDC_PREFETCH_PROFILE_DEF  0
+#define H5F_ACS_MDC_PREFETCH_PROFILE_ENC  H5P__encode_unsigned
+#define H5F_ACS_MDC_PREFETCH_PROFILE_DEC  H5P__decode_unsigned
 /* Definition for total size of page buffer(bytes) */
 #define H5F_ACS_PAGE_BUFFER_SIZE_SIZE sizeof(size_t)
 #define H5F_ACS_PAGE_BUFFER_SIZE_DEF  0
@@ -496,6 +501,8 @@ static const MPI_Info H5F_def_mpi_params_info_g = H5F_ACS_MPI_PARAMS_INFO_DEF; /
 #endif                                                                         /* H5_HAVE_PARALLEL */
 static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g =
     H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_DEF; /* Default metadata cache image settings */
+static const unsigned H5F_def_mdc_prefetch_profile_g =
+    H5F_ACS_MDC_PREFETCH_PROFILE_DEF; /* Default metadata cache prefetch profile size */
 static const size_t   H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF; /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default page buffer minimum metadata size */
@@ -763,6 +770,13 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_CMP, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the metadata cache prefetch profile size */
+    if (H5P__register_real(pclass, H5F_ACS_MDC_PREFETCH_PROFILE_NAME, H5F_ACS_MDC_PREFETCH_PROFILE_SIZE,
+                           &H5F_def_mdc_prefetch_profile_g, NULL, NULL, NULL,
+                           H5F_ACS_MDC_PREFETCH_PROFILE_ENC, H5F_ACS_MDC_PREFETCH_PROFILE_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the size of the page buffer size */
     if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_SIZE_NAME, H5F_ACS_PAGE_BUFFER_SIZE_SIZE,
                            &H5F_def_page_buf_size_g, NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_SIZE_ENC,
@@ -1848,6 +1862,74 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_mdc_image_config() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_prefetch_profile
+ *
+ * Purpose:     Set the maximum number of metadata cache entries to record
+ *              in the prefetch profile of files opened R/W with the
+ *              target FAPL.  Zero disables recording.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_prefetch_profile(hid_t plist_id, unsigned max_entries)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, max_entries);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Check argument */
+    if (max_entries > H5AC__MAX_PREFETCH_PROFILE_ENTRIES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "max_entries is too large")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_MDC_PREFETCH_PROFILE_NAME, &max_entries) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache prefetch profile size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_mdc_prefetch_profile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_prefetch_profile
+ *
+ * Purpose:     Retrieve the maximum number of metadata cache entries to
+ *              record in the prefetch profile from the target FAPL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_prefetch_profile(hid_t plist_id, unsigned *max_entries /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, max_entries);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (max_entries)
+        if (H5P_get(plist, H5F_ACS_MDC_PREFETCH_PROFILE_NAME, max_entries) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata cache prefetch profile size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_mdc_prefetch_profile() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_config
  *
@@ -3170,6 +3170,51 @@ H5_DLL herr_t H5Pget_alignment(hid_t fapl_id, hsize_t *threshold /*out*/, hsize_
  */
 H5_DLL herr_t H5Pget_cache(hid_t plist_id, int *mdc_nelmts, /* out */
                            size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/, double *rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Gets information about the memory mapping used by the core VFD
+ *
+ * \fapl_id
+ * \param[out] is_enabled   Whether the feature is enabled
+ * \param[out] reserve_size Size, in bytes, of the address space reserved
+ *                          for the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_core_mmap() retrieves the settings made with
+ *          H5Pset_core_mmap().
+ *
+ * \note This function is only for use with the core VFD and must be used
+ *       after the call to H5Pset_fapl_core(). It is an error to use this
+ *       function with any other VFD.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_core_mmap(hid_t fapl_id, hbool_t *is_enabled, size_t *reserve_size);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Gets the application-owned file image used by the core VFD
+ *
+ * \fapl_id
+ * \param[out] buf_ptr Pointer to the file image
+ * \param[out] buf_len Size of the file image, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_core_image() retrieves the file image set with
+ *          H5Pset_core_image(). No copy is made.
+ *
+ * \note This function is only for use with the core VFD and must be used
+ *       after the call to H5Pset_fapl_core(). It is an error to use this
+ *       function with any other VFD.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_core_image(hid_t fapl_id, const void **buf_ptr, size_t *buf_len);
 /**
  * \ingroup FAPL
  *
@@ -3475,6 +3520,25 @@ H5_DLL herr_t H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pget_mdc_log_options(hid_t plist_id, hbool_t *is_enabled, char *location,
                                      size_t *location_size, hbool_t *start_on_access);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the maximum size of the metadata cache prefetch profile
+ *
+ * \fapl_id{plist_id}
+ * \param[out] max_entries Maximum number of metadata cache entries recorded
+ *                         in the prefetch profile
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_mdc_prefetch_profile() retrieves the value set with
+ *          H5Pset_mdc_prefetch_profile().  Zero means that no profile
+ *          is recorded.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_mdc_prefetch_profile(hid_t plist_id, unsigned *max_entries /*out*/);
 H5_DLL herr_t H5Pget_meta_block_size(hid_t fapl_id, hsize_t *size /*out*/);
 H5_DLL herr_t H5Pget_metadata_read_attempts(hid_t plist_id, unsigned *attempts);
 /**
@@ -3684,6 +3748,75 @@ H5_DLL herr_t H5Pset_alignment(hid_t fapl_id, hsize_t threshold, hsize_t alignme
  */
 H5_DLL herr_t H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslots, size_t rdcc_nbytes,
                            double rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Opens an application-owned file image in place with the core VFD
+ *
+ * \fapl_id
+ * \param[in] buf_ptr Pointer to the file image
+ * \param[in] buf_len Size of the file image, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_core_image() makes the core VFD use the file image at
+ *          \p buf_ptr directly when a file is opened, instead of copying
+ *          it as H5Pset_file_image() does. The file name is only used to
+ *          identify the file; nothing is read from or written to disk.
+ *
+ *          The image remains owned by the application, which must keep it
+ *          valid and unchanged until the file and any snapshots taken with
+ *          H5Fget_file_image_snapshot() are closed. The file must be
+ *          opened read-only.
+ *
+ *          Passing NULL and 0 clears the setting.
+ *
+ * \note This function is only for use with the core VFD and must be used
+ *       after the call to H5Pset_fapl_core(). It is an error to use this
+ *       function with any other VFD.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_core_image(hid_t fapl_id, const void *buf_ptr, size_t buf_len);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Backs the memory of the core VFD with a memory mapping
+ *
+ * \fapl_id
+ * \param[in] is_enabled   Whether the feature is enabled
+ * \param[in] reserve_size Size, in bytes, of the address space to reserve
+ *                         for the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_core_mmap() makes the core VFD reserve \p reserve_size
+ *          bytes of virtual address space with an anonymous memory
+ *          mapping when a file is created or opened, instead of
+ *          allocating the file's memory with malloc() and growing it with
+ *          realloc(). Physical memory is only committed as the file grows
+ *          into the reservation, so growing the file never copies it. If
+ *          the file outgrows the reservation, a reservation of twice the
+ *          size is made and the file is moved into it.
+ *
+ *          Enabling the memory mapping also enables write tracking (see
+ *          H5Pset_core_write_tracking()) with the current page size, so
+ *          that flushing a file with a backing store only writes the pages
+ *          modified since the last flush. Call H5Pset_core_write_tracking()
+ *          after this function to disable write tracking again.
+ *
+ *          The setting is ignored on platforms without mmap() and when
+ *          file image callbacks are set with H5Pset_file_image_callbacks().
+ *
+ * \note This function is only for use with the core VFD and must be used
+ *       after the call to H5Pset_fapl_core(). It is an error to use this
+ *       function with any other VFD.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_core_mmap(hid_t fapl_id, hbool_t is_enabled, size_t reserve_size);
 H5_DLL herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
 /**
  * \ingroup FAPL
@@ -3916,6 +4049,49 @@ H5_DLL herr_t H5Pset_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver_
 H5_DLL herr_t H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5Pset_mdc_log_options(hid_t plist_id, hbool_t is_enabled, const char *location,
                                      hbool_t start_on_access);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Records a metadata cache prefetch profile for later opens of a file
+ *
+ * \fapl_id{plist_id}
+ * \param[in] max_entries Maximum number of metadata cache entries to record
+ *                        in the prefetch profile, or zero to disable
+ *                        recording
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_mdc_prefetch_profile() directs the metadata cache of a
+ *          file opened read/write with \p plist_id to record the address,
+ *          length and type of the first \p max_entries metadata entries
+ *          it loads from the file.  When the file is closed, this access
+ *          profile is stored in the superblock extension.
+ *
+ *          When a file containing a profile is later opened read-only, the
+ *          library sorts the profiled entries by address, merges them into
+ *          a small number of contiguous runs, and reads each run with a
+ *          single I/O request before the first metadata access.  Metadata
+ *          loads that fall inside a prefetched run are then satisfied from
+ *          memory, which replaces many small reads with a few large ones.
+ *          This helps short-lived read-only jobs on high-latency file
+ *          systems that repeatedly access the same metadata after open.
+ *
+ *          The profile is discarded whenever the file is opened read/write,
+ *          since the file may change.  If the fapl used for that open also
+ *          enables recording, a new profile replaces the old one at close.
+ *
+ *          \p max_entries may not exceed #H5AC__MAX_PREFETCH_PROFILE_ENTRIES.
+ *
+ * \note A profile is only stored in files with a version 2 or later
+ *       superblock (see H5Pset_libver_bounds()), and is neither recorded
+ *       nor used with parallel, SWMR or page buffered access, or when the
+ *       file contains a metadata cache image (see
+ *       H5Pset_mdc_image_config()).
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_mdc_prefetch_profile(hid_t plist_id, unsigned max_entries);
 H5_DLL herr_t H5Pset_meta_block_size(hid_t fapl_id, hsize_t size);
 H5_DLL herr_t H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
 H5_DLL herr_t H5Pset_multi_type(hid_t fapl_id, H5FD_mem_t type);
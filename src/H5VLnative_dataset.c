@@ -24,6 +24,7 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -361,6 +362,68 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_dataset_specific() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_io_multi
+ *
+ * Purpose:     Reads or writes multiple datasets, for the
+ *              H5VL_NATIVE_DATASET_READ_MULTI and
+ *              H5VL_NATIVE_DATASET_WRITE_MULTI optional operations.
+ *              Exactly one of RBUF and WBUF is non-NULL.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_dataset_io_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                              const hid_t mem_space_id[], const hid_t file_space_id[], void *rbuf[],
+                              const void *wbuf[])
+{
+    H5D_t **      dsets       = NULL;    /* Datasets */
+    const H5S_t **mem_spaces  = NULL;    /* Memory dataspaces */
+    const H5S_t **file_spaces = NULL;    /* File dataspaces */
+    size_t        u;                     /* Local index variable */
+    herr_t        ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Allocate arrays of dataset & dataspace pointers */
+    if (NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate array of datasets")
+    if (NULL == (mem_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate array of memory dataspaces")
+    if (NULL == (file_spaces = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate array of file dataspaces")
+
+    /* Get validated dataset & dataspace pointers */
+    for (u = 0; u < count; u++) {
+        if (NULL == (dsets[u] = (H5D_t *)H5VL_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (NULL == dsets[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+        if (H5S_get_validated_dataspace(mem_space_id[u], &mem_spaces[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+        if (H5S_get_validated_dataspace(file_space_id[u], &file_spaces[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+    /* Read or write the data */
+    if (rbuf) {
+        if (H5D__read_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, rbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else if (H5D__write_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, wbuf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(dsets);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(file_spaces);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_io_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_optional
  *
@@ -594,6 +657,36 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        /* H5Dread_multi */
+        case H5VL_NATIVE_DATASET_READ_MULTI: {
+            size_t       count         = HDva_arg(arguments, size_t);
+            const hid_t *dset_id       = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_type_id   = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_space_id  = HDva_arg(arguments, const hid_t *);
+            const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+            void **      buf           = HDva_arg(arguments, void **);
+
+            if (H5VL__native_dataset_io_multi(count, dset_id, mem_type_id, mem_space_id, file_space_id, buf,
+                                              NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            break;
+        }
+
+        /* H5Dwrite_multi */
+        case H5VL_NATIVE_DATASET_WRITE_MULTI: {
+            size_t       count         = HDva_arg(arguments, size_t);
+            const hid_t *dset_id       = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_type_id   = HDva_arg(arguments, const hid_t *);
+            const hid_t *mem_space_id  = HDva_arg(arguments, const hid_t *);
+            const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+            const void **buf           = HDva_arg(arguments, const void **);
+
+            if (H5VL__native_dataset_io_multi(count, dset_id, mem_type_id, mem_space_id, file_space_id, NULL,
+                                              buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
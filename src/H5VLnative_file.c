@@ -782,6 +782,21 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
                 HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "cannot set MPI atomicity");
             break;
         }
+
+        /* H5Fget_mpi_sync_point_stats */
+        case H5VL_NATIVE_FILE_GET_MPI_SYNC_POINT_STATS: {
+            H5F_sync_point_stats_t *stats = HDva_arg(arguments, H5F_sync_point_stats_t *);
+            if (H5AC_get_sync_point_stats(f, stats) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "cannot get sync point statistics");
+            break;
+        }
+
+        /* H5Freset_mpi_sync_point_stats */
+        case H5VL_NATIVE_FILE_RESET_MPI_SYNC_POINT_STATS: {
+            if (H5AC_reset_sync_point_stats(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "cannot reset sync point statistics");
+            break;
+        }
 #endif /* H5_HAVE_PARALLEL */
 
         /* Finalize H5Fopen */
@@ -792,6 +807,28 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
             break;
         }
 
+        /* H5Fget_file_image_snapshot */
+        case H5VL_NATIVE_FILE_GET_FILE_IMAGE_SNAPSHOT: {
+            const void **buf_ptr  = HDva_arg(arguments, const void **);
+            void **      snapshot = HDva_arg(arguments, void **);
+            ssize_t *    ret      = HDva_arg(arguments, ssize_t *);
+
+            /* Do the actual work */
+            if ((*ret = H5F__get_file_image_snapshot(f, buf_ptr, snapshot)) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "get file image snapshot failed")
+            break;
+        }
+
+        /* H5Fcompact */
+        case H5VL_NATIVE_FILE_COMPACT: {
+            hsize_t  max_bytes   = HDva_arg(arguments, hsize_t);
+            hsize_t *bytes_moved = HDva_arg(arguments, hsize_t *);
+
+            if (H5F__compact(f, max_bytes, bytes_moved) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTMOVE, FAIL, "unable to compact file")
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
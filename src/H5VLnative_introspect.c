@@ -91,10 +91,12 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 
                 case H5VL_NATIVE_DATASET_CHUNK_READ:
+                case H5VL_NATIVE_DATASET_READ_MULTI:
                     *flags |= H5VL_OPT_QUERY_READ_DATA;
                     break;
 
                 case H5VL_NATIVE_DATASET_CHUNK_WRITE:
+                case H5VL_NATIVE_DATASET_WRITE_MULTI:
                     *flags |= H5VL_OPT_QUERY_WRITE_DATA;
                     break;
 
@@ -116,6 +118,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 
                 case H5VL_NATIVE_FILE_GET_FILE_IMAGE:
+                case H5VL_NATIVE_FILE_GET_FILE_IMAGE_SNAPSHOT:
                     *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
                     *flags |= H5VL_OPT_QUERY_READ_DATA;
                     break;
@@ -133,6 +136,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 
                 case H5VL_NATIVE_FILE_START_SWMR_WRITE:
+                case H5VL_NATIVE_FILE_COMPACT:
                     *flags |= H5VL_OPT_QUERY_MODIFY_METADATA;
                     *flags |= H5VL_OPT_QUERY_WRITE_DATA;
                     *flags |= H5VL_OPT_QUERY_NO_ASYNC;
@@ -152,6 +156,8 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_SET_MIN_DSET_OHDR_FLAG:
                 case H5VL_NATIVE_FILE_GET_MPI_ATOMICITY:
                 case H5VL_NATIVE_FILE_SET_MPI_ATOMICITY:
+                case H5VL_NATIVE_FILE_GET_MPI_SYNC_POINT_STATS:
+                case H5VL_NATIVE_FILE_RESET_MPI_SYNC_POINT_STATS:
                 case H5VL_NATIVE_FILE_POST_OPEN:
                     break;
 
@@ -3484,6 +3484,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_READ_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_READ_MULTI");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_WRITE_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_WRITE_MULTI");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3620,6 +3628,22 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
 
+                                case H5VL_NATIVE_FILE_GET_FILE_IMAGE_SNAPSHOT:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_GET_FILE_IMAGE_SNAPSHOT");
+                                    break;
+
+                                case H5VL_NATIVE_FILE_GET_MPI_SYNC_POINT_STATS:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_GET_MPI_SYNC_POINT_STATS");
+                                    break;
+
+                                case H5VL_NATIVE_FILE_RESET_MPI_SYNC_POINT_STATS:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_RESET_MPI_SYNC_POINT_STATS");
+                                    break;
+
+                                case H5VL_NATIVE_FILE_COMPACT:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_COMPACT");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
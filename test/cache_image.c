@@ -34,6 +34,10 @@ static void open_hdf5_file(hbool_t create_file, hbool_t mdci_sbem_expected, hboo
 static void attempt_swmr_open_hdf5_file(hbool_t create_file, hbool_t set_mdci_fapl,
                                         const char *hdf_file_name);
 static void verify_datasets(hid_t file_id, int min_dset, int max_dset);
+#ifndef H5_HAVE_PARALLEL
+static void prefetch_profile_open(const char *filename, unsigned flags, unsigned max_entries,
+                                  hid_t *file_id_ptr, H5C_t **cache_ptr_ptr);
+#endif /* H5_HAVE_PARALLEL */
 
 /* local test function declarations */
 static unsigned check_cache_image_ctl_flow_1(hbool_t single_file_vfd);
@@ -57,6 +61,7 @@ static unsigned cache_image_api_error_check_4(hbool_t single_file_vfd);
 
 static unsigned get_free_sections_test(hbool_t single_file_vfd);
 static unsigned evict_on_close_test(hbool_t single_file_vfd);
+static unsigned prefetch_profile_test(hbool_t single_file_vfd);
 
 /****************************************************************************/
 /***************************** Utility Functions ****************************/
@@ -7813,6 +7818,262 @@ evict_on_close_test(hbool_t single_file_vfd)
 
 } /* evict_on_close_test() */
 
+/*-------------------------------------------------------------------------
+ * Function:    prefetch_profile_open()
+ *
+ * Purpose:     If pass is TRUE on entry, open the indicated file with
+ *              the latest file format, the indicated access flags and
+ *              prefetch profile size, and return the file ID and the
+ *              file's metadata cache.
+ *
+ *              On failure, set pass to FALSE, and set failure_mssg
+ *              to point to an appropriate failure message.
+ *
+ *              Do nothing if pass is FALSE on entry.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef H5_HAVE_PARALLEL
+static void
+prefetch_profile_open(const char *filename, unsigned flags, unsigned max_entries, hid_t *file_id_ptr,
+                      H5C_t **cache_ptr_ptr)
+{
+    unsigned max_entries_out = 0;
+    hid_t    fapl_id         = -1;
+    H5F_t *  file_ptr        = NULL;
+
+    if (pass) {
+
+        if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Pcreate() failed.\n";
+        }
+        else if (H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Pset_libver_bounds() failed.\n";
+        }
+        else if (H5Pset_mdc_prefetch_profile(fapl_id, max_entries) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Pset_mdc_prefetch_profile() failed.\n";
+        }
+        else if (H5Pget_mdc_prefetch_profile(fapl_id, &max_entries_out) < 0 ||
+                 max_entries_out != max_entries) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Pget_mdc_prefetch_profile() failed.\n";
+        }
+    }
+
+    if (pass) {
+
+        if (flags & H5F_ACC_TRUNC)
+            *file_id_ptr = H5Fcreate(filename, flags, H5P_DEFAULT, fapl_id);
+        else
+            *file_id_ptr = H5Fopen(filename, flags, fapl_id);
+
+        if (*file_id_ptr < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fcreate() or H5Fopen() failed.\n";
+        }
+        else if (NULL == (file_ptr = (H5F_t *)H5VL_object_verify(*file_id_ptr, H5I_FILE))) {
+
+            pass         = FALSE;
+            failure_mssg = "Can't get file_ptr.\n";
+        }
+        else
+            *cache_ptr_ptr = file_ptr->shared->cache;
+    }
+
+    if (fapl_id >= 0 && H5Pclose(fapl_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Pclose() failed.\n";
+    }
+
+} /* prefetch_profile_open() */
+#endif /* H5_HAVE_PARALLEL */
+
+/*-------------------------------------------------------------------------
+ * Function:    prefetch_profile_test()
+ *
+ * Purpose:     Verify the metadata cache prefetch profile: the profile
+ *              recorded while the file is open R/W is stored on file
+ *              close, used to prefetch metadata when the file is next
+ *              opened R/O, and removed when the file is opened R/W.
+ *
+ *              Do this as follows:
+ *
+ *              1) Create a file and some datasets, and close it.
+ *
+ *              2) Open the file R/W with a prefetch profile requested,
+ *                 verify the datasets, and close the file.  The profile
+ *                 is now stored in the file.
+ *
+ *              3) Open the file R/O, and verify that the profile is
+ *                 used to read the metadata needed to verify the
+ *                 datasets.  Close the file.
+ *
+ *              4) Open the file R/W without a prefetch profile
+ *                 requested, and close it.  This removes the profile.
+ *
+ *              5) Open the file R/O, and verify that no metadata is
+ *                 prefetched.  Close and discard the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+prefetch_profile_test(hbool_t single_file_vfd)
+{
+#ifndef H5_HAVE_PARALLEL
+    char   filename[512];
+    hid_t  file_id   = -1;
+    H5C_t *cache_ptr = NULL;
+#endif /* H5_HAVE_PARALLEL */
+
+    TESTING("Metadata cache prefetch profile");
+
+#ifdef H5_HAVE_PARALLEL
+    SKIPPED();
+    HDputs("    Prefetch profile not supported in the parallel library.");
+    return 0;
+#else
+
+    /* Check for VFD that is a single file */
+    if (!single_file_vfd) {
+        SKIPPED();
+        HDputs("    Prefetch profile not tested with the current VFD.");
+        return 0;
+    }
+
+    pass = TRUE;
+
+    /* setup the file name */
+    if (pass) {
+
+        if (h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL) {
+
+            pass         = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    /* 1) Create a file and some datasets, and close it. */
+    prefetch_profile_open(filename, H5F_ACC_TRUNC, 0, &file_id, &cache_ptr);
+
+    if (pass)
+        create_datasets(file_id, 1, 5);
+
+    if (pass && H5Fclose(file_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Fclose() failed (1).\n";
+    }
+
+    /* 2) Open the file R/W with a prefetch profile requested, verify
+     *    the datasets, and close the file.
+     */
+    prefetch_profile_open(filename, H5F_ACC_RDWR, 256, &file_id, &cache_ptr);
+
+    if (pass)
+        verify_datasets(file_id, 1, 5);
+
+    if (pass && (cache_ptr->pf_nentries == 0 || cache_ptr->pf_nentries > 256)) {
+
+        pass         = FALSE;
+        failure_mssg = "unexpected number of recorded prefetch profile entries.\n";
+    }
+
+    if (pass && H5Fclose(file_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Fclose() failed (2).\n";
+    }
+
+    /* 3) Open the file R/O, and verify that the profile is used. */
+    prefetch_profile_open(filename, H5F_ACC_RDONLY, 0, &file_id, &cache_ptr);
+
+    if (pass)
+        verify_datasets(file_id, 1, 5);
+
+    if (pass && (cache_ptr->pf_reads == 0 || cache_ptr->pf_hits == 0)) {
+
+        pass         = FALSE;
+        failure_mssg = "prefetch profile not used on R/O open.\n";
+    }
+
+    if (pass && H5Fclose(file_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Fclose() failed (3).\n";
+    }
+
+    /* 4) Open the file R/W without a prefetch profile requested, and
+     *    close it.
+     */
+    prefetch_profile_open(filename, H5F_ACC_RDWR, 0, &file_id, &cache_ptr);
+
+    if (pass)
+        verify_datasets(file_id, 1, 5);
+
+    if (pass && (cache_ptr->pf_reads != 0 || cache_ptr->pf_hits != 0)) {
+
+        pass         = FALSE;
+        failure_mssg = "prefetch profile used on R/W open.\n";
+    }
+
+    if (pass && H5Fclose(file_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Fclose() failed (4).\n";
+    }
+
+    /* 5) Open the file R/O, and verify that no metadata is prefetched. */
+    prefetch_profile_open(filename, H5F_ACC_RDONLY, 0, &file_id, &cache_ptr);
+
+    if (pass)
+        verify_datasets(file_id, 1, 5);
+
+    if (pass && (cache_ptr->pf_reads != 0 || cache_ptr->pf_hits != 0)) {
+
+        pass         = FALSE;
+        failure_mssg = "stale prefetch profile not removed.\n";
+    }
+
+    if (pass && H5Fclose(file_id) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "H5Fclose() failed (5).\n";
+    }
+
+    if (pass && HDremove(filename) < 0) {
+
+        pass         = FALSE;
+        failure_mssg = "HDremove() failed.\n";
+    }
+
+    if (pass) {
+        PASSED();
+    }
+    else {
+        H5_FAILED();
+    }
+
+    if (!pass)
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+
+    return !pass;
+#endif /* H5_HAVE_PARALLEL */
+
+} /* prefetch_profile_test() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -7874,6 +8135,7 @@ main(void)
 
     nerrs += get_free_sections_test(single_file_vfd);
     nerrs += evict_on_close_test(single_file_vfd);
+    nerrs += prefetch_profile_test(single_file_vfd);
 
     return (nerrs > 0);
 
@@ -83,6 +83,8 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "multi_dset_io",       /* 27 */
+                          "sieve_windows",       /* 28 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -13108,6 +13110,358 @@ error:
     return FAIL;
 } /* end test_power2up() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests H5Dwrite_multi and H5Dread_multi on a mix of
+ *              contiguous and chunked datasets, with partial selections
+ *              and datatype conversion.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NDSETS 3
+#define MULTI_DIM0   8
+#define MULTI_DIM1   12
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid  = -1;                                /* File ID */
+    hid_t       dcpl = -1;                                /* Dataset creation property list */
+    hid_t       sid  = -1;                                /* Dataspace ID */
+    hid_t       fsid = -1;                                /* File dataspace with partial selection */
+    hid_t       msid = -1;                                /* Memory dataspace for partial selection */
+    hid_t       dids[MULTI_NDSETS]      = {-1, -1, -1};   /* Dataset IDs */
+    hid_t       mem_tids[MULTI_NDSETS];                   /* Memory datatypes */
+    hid_t       mem_sids[MULTI_NDSETS];                   /* Memory dataspaces */
+    hid_t       file_sids[MULTI_NDSETS];                  /* File dataspaces */
+    const void *wbufs[MULTI_NDSETS];                      /* Write buffers */
+    void *      rbufs[MULTI_NDSETS];                      /* Read buffers */
+    int         wdata0[MULTI_DIM0][MULTI_DIM1];           /* Data written to dataset 0 */
+    int         wdata1[MULTI_DIM0][MULTI_DIM1];           /* Data written to dataset 1 */
+    int         wdata2[MULTI_DIM0 / 2][MULTI_DIM1];       /* Data written to dataset 2 */
+    int         rdata0[MULTI_DIM0][MULTI_DIM1];           /* Data read from dataset 0 */
+    long long   rdata1[MULTI_DIM0][MULTI_DIM1];           /* Data read from dataset 1 */
+    int         rdata2[MULTI_DIM0][MULTI_DIM1];           /* Data read from dataset 2 */
+    hsize_t     dims[2]       = {MULTI_DIM0, MULTI_DIM1}; /* Dataset dimensions */
+    hsize_t     mdims[2]      = {MULTI_DIM0 / 2, MULTI_DIM1};
+    hsize_t     chunk_dims[2] = {2, 4};
+    hsize_t     start[2]      = {MULTI_DIM0 / 2, 0};
+    char        name[16];
+    int         i, j;
+    size_t      u;
+    herr_t      status; /* Error status */
+
+    TESTING("multi-dataset read/write");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+        FAIL_STACK_ERROR
+
+    /* Two contiguous datasets and a chunked one */
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        HDsnprintf(name, sizeof(name), "dset%u", (unsigned)u);
+        if (u == MULTI_NDSETS - 1 && H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+            FAIL_STACK_ERROR
+        if ((dids[u] = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* The chunked dataset only gets its second half written */
+    if ((fsid = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, mdims, NULL) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(2, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < MULTI_DIM0; i++)
+        for (j = 0; j < MULTI_DIM1; j++) {
+            wdata0[i][j] = i * MULTI_DIM1 + j;
+            wdata1[i][j] = -(i * MULTI_DIM1 + j);
+            if (i < MULTI_DIM0 / 2)
+                wdata2[i][j] = 1000 + i * MULTI_DIM1 + j;
+        } /* end for */
+
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        mem_tids[u]  = H5T_NATIVE_INT;
+        mem_sids[u]  = H5S_ALL;
+        file_sids[u] = H5S_ALL;
+    } /* end for */
+    mem_sids[2]  = msid;
+    file_sids[2] = fsid;
+    wbufs[0]     = wdata0;
+    wbufs[1]     = wdata1;
+    wbufs[2]     = wdata2;
+
+    if (H5Dwrite_multi(MULTI_NDSETS, dids, mem_tids, mem_sids, file_sids, H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read everything back, converting the second dataset */
+    HDmemset(rdata0, 0, sizeof(rdata0));
+    HDmemset(rdata1, 0, sizeof(rdata1));
+    HDmemset(rdata2, 0, sizeof(rdata2));
+    mem_tids[1]  = H5T_NATIVE_LLONG;
+    mem_sids[2]  = H5S_ALL;
+    file_sids[2] = H5S_ALL;
+    rbufs[0]     = rdata0;
+    rbufs[1]     = rdata1;
+    rbufs[2]     = rdata2;
+
+    if (H5Dread_multi(MULTI_NDSETS, dids, mem_tids, mem_sids, file_sids, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < MULTI_DIM0; i++)
+        for (j = 0; j < MULTI_DIM1; j++) {
+            if (rdata0[i][j] != wdata0[i][j])
+                FAIL_PUTS_ERROR("incorrect data read from contiguous dataset")
+            if (rdata1[i][j] != (long long)wdata1[i][j])
+                FAIL_PUTS_ERROR("incorrect data read from converted dataset")
+            if (rdata2[i][j] != (i < MULTI_DIM0 / 2 ? 0 : wdata2[i - MULTI_DIM0 / 2][j]))
+                FAIL_PUTS_ERROR("incorrect data read from chunked dataset")
+        } /* end for */
+
+    /* Bad arguments should fail */
+    H5E_BEGIN_TRY
+    {
+        status = H5Dread_multi(MULTI_NDSETS, NULL, mem_tids, mem_sids, file_sids, H5P_DEFAULT, rbufs);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        FAIL_PUTS_ERROR("H5Dread_multi succeeded with no datasets")
+    H5E_BEGIN_TRY
+    {
+        status = H5Dwrite_multi(MULTI_NDSETS, dids, mem_tids, mem_sids, file_sids, H5P_DEFAULT, NULL);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        FAIL_PUTS_ERROR("H5Dwrite_multi succeeded with no buffers")
+
+    for (u = 0; u < MULTI_NDSETS; u++)
+        if (H5Dclose(dids[u]) < 0)
+            FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(fsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < MULTI_NDSETS; u++)
+            H5Dclose(dids[u]);
+        H5Sclose(msid);
+        H5Sclose(fsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_multi_dset_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sieve_windows_io
+ *
+ * Purpose:     Reads or writes a run of elements in one row of the
+ *              dataset used by test_sieve_windows.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+sieve_windows_io(hid_t did, hid_t fsid, hbool_t do_write, hsize_t row, hsize_t col, hsize_t count, int *buf)
+{
+    hid_t   msid     = -1;
+    hsize_t start[2] = {row, col};
+    hsize_t block[2] = {1, count};
+
+    if ((msid = H5Screate_simple(1, &count, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, block, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (do_write) {
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf) < 0)
+            FAIL_STACK_ERROR
+    }
+    else if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(msid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end sieve_windows_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_windows
+ *
+ * Purpose:     Tests that reads from a contiguous dataset see the right
+ *              data with interleaved, sequential and random access
+ *              patterns, which use several data sieve windows and
+ *              readahead, and when reads are mixed with writes.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SIEVE_DIM0     64
+#define SIEVE_DIM1     256
+#define SIEVE_BUF_SIZE 1024
+static herr_t
+test_sieve_windows(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   my_fapl = -1;                       /* File access property list */
+    hid_t   fid     = -1;                       /* File ID */
+    hid_t   sid     = -1;                       /* Dataspace ID */
+    hid_t   did     = -1;                       /* Dataset ID */
+    int *   wdata   = NULL;                     /* Copy of the dataset's data */
+    int     rbuf[SIEVE_DIM1];                   /* Read buffer */
+    int     wbuf[8];                            /* Write buffer */
+    hsize_t dims[2] = {SIEVE_DIM0, SIEVE_DIM1}; /* Dataset dimensions */
+    hsize_t row, col, count;
+    int     i, j, k;
+
+    TESTING("data sieve windows");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    if (NULL == (wdata = (int *)HDmalloc(SIEVE_DIM0 * SIEVE_DIM1 * sizeof(int))))
+        TEST_ERROR
+    for (i = 0; i < SIEVE_DIM0 * SIEVE_DIM1; i++)
+        wdata[i] = i;
+
+    /* Use a sieve buffer that holds one row of the dataset */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)SIEVE_BUF_SIZE) < 0)
+        FAIL_STACK_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        FAIL_STACK_ERROR
+
+    /* Interleaved reads from three rows far apart */
+    for (j = 0; j < SIEVE_DIM1; j += 8)
+        for (k = 0; k < 3; k++) {
+            row = (hsize_t)(k * 20);
+            if (sieve_windows_io(did, sid, FALSE, row, (hsize_t)j, (hsize_t)8, rbuf) < 0)
+                TEST_ERROR
+            if (HDmemcmp(rbuf, &wdata[row * SIEVE_DIM1 + (hsize_t)j], 8 * sizeof(int)) != 0)
+                TEST_ERROR
+        } /* end for */
+
+    /* Sequential scan, half a row at a time */
+    for (i = 0; i < SIEVE_DIM0; i++)
+        for (j = 0; j < SIEVE_DIM1; j += SIEVE_DIM1 / 2) {
+            if (sieve_windows_io(did, sid, FALSE, (hsize_t)i, (hsize_t)j, (hsize_t)(SIEVE_DIM1 / 2), rbuf) <
+                0)
+                TEST_ERROR
+            if (HDmemcmp(rbuf, &wdata[i * SIEVE_DIM1 + j], (SIEVE_DIM1 / 2) * sizeof(int)) != 0)
+                TEST_ERROR
+        } /* end for */
+
+    /* Random reads mixed with writes */
+    HDsrandom(42);
+    for (i = 0; i < 4000; i++) {
+        row   = (hsize_t)HDrandom() % SIEVE_DIM0;
+        col   = (hsize_t)HDrandom() % (SIEVE_DIM1 - 8);
+        count = 1 + (hsize_t)HDrandom() % 8;
+
+        if (0 == HDrandom() % 4) {
+            for (k = 0; k < (int)count; k++)
+                wbuf[k] = -(i * 8 + k);
+            if (sieve_windows_io(did, sid, TRUE, row, col, count, wbuf) < 0)
+                TEST_ERROR
+            HDmemcpy(&wdata[row * SIEVE_DIM1 + col], wbuf, (size_t)count * sizeof(int));
+        } /* end if */
+        else {
+            if (sieve_windows_io(did, sid, FALSE, row, col, count, rbuf) < 0)
+                TEST_ERROR
+            if (HDmemcmp(rbuf, &wdata[row * SIEVE_DIM1 + col], (size_t)count * sizeof(int)) != 0)
+                TEST_ERROR
+        } /* end else */
+    }     /* end for */
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the data in the file */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SIEVE_DIM0; i++) {
+        if (sieve_windows_io(did, sid, FALSE, (hsize_t)i, (hsize_t)0, (hsize_t)SIEVE_DIM1, rbuf) < 0)
+            TEST_ERROR
+        if (HDmemcmp(rbuf, &wdata[i * SIEVE_DIM1], SIEVE_DIM1 * sizeof(int)) != 0)
+            TEST_ERROR
+    } /* end for */
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+    HDfree(wdata);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(wdata);
+    return FAIL;
+} /* end test_sieve_windows() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -15267,6 +15621,8 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_multi_dset_io(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sieve_windows(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
@@ -686,6 +686,200 @@ error:
     return 1;
 } /* end test_core() */
 
+/******************************************************************************
+ * Function:    test_core_image_snapshot
+ *
+ * Purpose:     Tests opening application-owned file images in place with
+ *              H5Pset_core_image() and taking copy-on-write snapshots with
+ *              H5Fget_file_image_snapshot(), with and without the memory
+ *              of the file being reserved with H5Pset_core_mmap().
+ *
+ ******************************************************************************
+ */
+static int
+test_core_image_snapshot(hbool_t use_mmap)
+{
+    hid_t          fapl = -1, image_fapl = -1;
+    hid_t          file = -1, image_file = -1;
+    hid_t          dset  = -1;
+    hid_t          space = -1;
+    hsize_t        dims[2];
+    int *          wbuf = NULL, *rbuf = NULL;
+    unsigned char *image_copy = NULL;
+    const void *   snap_ptr = NULL, *image_snap_ptr = NULL, *snap2_ptr = NULL;
+    void *         snap = NULL, *image_snap = NULL, *snap2 = NULL;
+    const void *   image_ptr = NULL;
+    size_t         image_len = 0;
+    ssize_t        snap_size, image_size;
+    size_t         u;
+
+    if (use_mmap) {
+        TESTING("zero-copy file images and snapshots in Core VFD with mmap");
+    }
+    else {
+        TESTING("zero-copy file images and snapshots in Core VFD");
+    }
+
+    /* Set up data */
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1)))
+        TEST_ERROR
+    for (u = 0; u < DIM0 * DIM1; u++)
+        wbuf[u] = (int)u;
+
+    /* Create an in-memory file with a dataset */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fapl_core(fapl, (size_t)(64 * 1024), FALSE) < 0)
+        FAIL_STACK_ERROR
+    if (use_mmap && H5Pset_core_mmap(fapl, TRUE, (size_t)(64 * 1024)) < 0)
+        FAIL_STACK_ERROR
+    if ((file = H5Fcreate("core_image_snapshot", H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    dims[0] = DIM0;
+    dims[1] = DIM1;
+    if ((space = H5Screate_simple(RANK, dims, dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset = H5Dcreate2(file, DSET_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fflush(file, H5F_SCOPE_LOCAL) < 0)
+        FAIL_STACK_ERROR
+
+    /* Take a snapshot and check it against a copy of the image */
+    if ((snap_size = H5Fget_file_image_snapshot(file, &snap_ptr, &snap)) < 0)
+        FAIL_STACK_ERROR
+    if (NULL == snap_ptr || NULL == snap)
+        TEST_ERROR
+    if ((image_size = H5Fget_file_image(file, NULL, (size_t)0)) != snap_size)
+        TEST_ERROR
+    if (NULL == (image_copy = (unsigned char *)HDmalloc((size_t)image_size)))
+        TEST_ERROR
+    if (H5Fget_file_image(file, image_copy, (size_t)image_size) != image_size)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(snap_ptr, image_copy, (size_t)snap_size) != 0)
+        TEST_ERROR
+
+    /* Snapshots taken before the file changes share the same memory */
+    if (H5Fget_file_image_snapshot(file, &snap2_ptr, &snap2) != snap_size)
+        FAIL_STACK_ERROR
+    if (snap2_ptr != snap_ptr)
+        TEST_ERROR
+    if (H5Frelease_file_image_snapshot(snap2) < 0)
+        FAIL_STACK_ERROR
+
+    /* Change the file, which must not change the snapshot */
+    for (u = 0; u < DIM0 * DIM1; u++)
+        wbuf[u] = -(int)u;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fflush(file, H5F_SCOPE_LOCAL) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(snap_ptr, image_copy, (size_t)snap_size) != 0)
+        TEST_ERROR
+
+    /* A snapshot of the changed file has its own memory */
+    if (H5Fget_file_image_snapshot(file, &snap2_ptr, &snap2) < 0)
+        FAIL_STACK_ERROR
+    if (snap2_ptr == snap_ptr)
+        TEST_ERROR
+    if (H5Frelease_file_image_snapshot(snap2) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the snapshot in place */
+    if ((image_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fapl_core(image_fapl, (size_t)(64 * 1024), FALSE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_core_image(image_fapl, snap_ptr, (size_t)snap_size) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_core_image(image_fapl, &image_ptr, &image_len) < 0)
+        FAIL_STACK_ERROR
+    if (image_ptr != snap_ptr || image_len != (size_t)snap_size)
+        TEST_ERROR
+
+    /* Application-owned images can't be opened for writing */
+    H5E_BEGIN_TRY
+    {
+        image_file = H5Fopen("core_image_snapshot_ro", H5F_ACC_RDWR, image_fapl);
+    }
+    H5E_END_TRY;
+    if (image_file >= 0)
+        TEST_ERROR
+
+    if ((image_file = H5Fopen("core_image_snapshot_ro", H5F_ACC_RDONLY, image_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The snapshot still holds the original data */
+    if (H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+    if ((dset = H5Dopen2(image_file, DSET_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < DIM0 * DIM1; u++)
+        if (rbuf[u] != (int)u)
+            TEST_ERROR
+    if (H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+    dset = -1;
+
+    /* Snapshots of an application-owned image share it */
+    if ((image_size = H5Fget_file_image_snapshot(image_file, &image_snap_ptr, &image_snap)) < 0)
+        FAIL_STACK_ERROR
+    if (image_size != snap_size || image_snap_ptr != snap_ptr)
+        TEST_ERROR
+
+    /* Snapshots may outlive their files */
+    if (H5Fclose(image_file) < 0)
+        FAIL_STACK_ERROR
+    image_file = -1;
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+    file = -1;
+    if (HDmemcmp(snap_ptr, image_copy, (size_t)snap_size) != 0)
+        TEST_ERROR
+    if (H5Frelease_file_image_snapshot(image_snap) < 0)
+        FAIL_STACK_ERROR
+    if (H5Frelease_file_image_snapshot(snap) < 0)
+        FAIL_STACK_ERROR
+
+    /* Release resources */
+    if (H5Sclose(space) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(image_fapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR
+    HDfree(image_copy);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(image_file);
+        H5Fclose(file);
+        H5Pclose(image_fapl);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(image_copy);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_core_image_snapshot() */
+
 /******************************************************************************
  * Function:    test_get_file_image
  *
@@ -1338,6 +1532,8 @@ main(void)
     errors += test_properties();
     errors += test_callbacks();
     errors += test_core();
+    errors += test_core_image_snapshot(FALSE);
+    errors += test_core_image_snapshot(TRUE);
 
     /* Perform tests with/without user block */
     for (user = FALSE; user <= TRUE; user++) {
@@ -2136,6 +2136,140 @@ error:
     return (1);
 } /* test_mf_fs_absorb() */
 
+/*
+ *-------------------------------------------------------------------------
+ * To verify that blocks freed in a batch are merged before they reach
+ * the free-space manager
+ *
+ * Set up:
+ *     Turn off using meta/small data aggregator
+ *
+ *    Allocate 8 adjoining blocks of size=30 and a guard block after them
+ *    Start a free space batch and free the 8 blocks out of order
+ *    Nothing should reach the free-space manager until the batch ends
+ *    End the batch: there should be a single section of size=240
+ *    Free the guard block: the section and the block should shrink the EOA
+ *    The file should be back to its original size
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_mf_fs_free_batch(hid_t fapl)
+{
+    hid_t          file     = -1;            /* File ID */
+    hid_t          fapl_new = -1;            /* copy of fapl */
+    char           filename[FILENAME_LEN];   /* Filename to use */
+    H5F_t *        f = NULL;                 /* Internal file object pointer */
+    h5_stat_size_t file_size, new_file_size; /* file size */
+    haddr_t        addrs[8];                 /* Addresses of the blocks */
+    haddr_t        guard_addr;               /* Address of the guard block */
+    unsigned       order[8] = {5, 0, 7, 2, 6, 1, 4, 3};
+    H5FS_stat_t    state;
+    unsigned       u;
+
+    TESTING("H5MF_xfree() of blocks in a free space batch");
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    if ((fapl_new = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+
+    /* Create the file to work on */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close file */
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Get the size of a file */
+    if ((file_size = h5_get_file_size(filename, fapl)) < 0)
+        TEST_ERROR
+
+    /* Turn off using meta/small data aggregator */
+    H5Pset_meta_block_size(fapl_new, (hsize_t)0);
+    H5Pset_small_data_block_size(fapl_new, (hsize_t)0);
+
+    /* Re-open the file with meta/small data setting */
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl_new)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Get a pointer to the internal file object */
+    if (NULL == (f = (H5F_t *)H5VL_object(file)))
+        FAIL_STACK_ERROR
+
+    /* Start up H5FD_MEM_SUPER free-space manager */
+    if (H5MF__start_fstype(f, (H5F_mem_page_t)H5FD_MEM_SUPER) < 0)
+        FAIL_STACK_ERROR
+
+    /* Allocate the adjoining blocks and the guard block */
+    for (u = 0; u < 8; u++) {
+        if (HADDR_UNDEF == (addrs[u] = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE30)))
+            FAIL_STACK_ERROR
+        if (u > 0 && addrs[u] != addrs[u - 1] + TBLOCK_SIZE30)
+            TEST_ERROR
+    } /* end for */
+    if (HADDR_UNDEF == (guard_addr = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE30)))
+        FAIL_STACK_ERROR
+
+    /* Free the blocks out of order in a batch */
+    if (H5MF_free_batch_begin(f) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < 8; u++)
+        if (H5MF_xfree(f, H5FD_MEM_SUPER, addrs[order[u]], (hsize_t)TBLOCK_SIZE30) < 0)
+            FAIL_STACK_ERROR
+
+    /* Nothing should be in the free-space manager yet */
+    HDmemset(&state, 0, sizeof(H5FS_stat_t));
+    if (check_stats(f, f->shared->fs_man[H5FD_MEM_SUPER], &state))
+        TEST_ERROR
+
+    if (H5MF_free_batch_end(f) < 0)
+        FAIL_STACK_ERROR
+
+    /* The blocks should have been merged into a single section */
+    state.tot_space += 8 * TBLOCK_SIZE30;
+    state.tot_sect_count += 1;
+    state.serial_sect_count += 1;
+    if (check_stats(f, f->shared->fs_man[H5FD_MEM_SUPER], &state))
+        TEST_ERROR
+
+    /* Free the guard block, which should shrink the EOA */
+    if (H5MF_xfree(f, H5FD_MEM_SUPER, guard_addr, (hsize_t)TBLOCK_SIZE30) < 0)
+        FAIL_STACK_ERROR
+
+    HDmemset(&state, 0, sizeof(H5FS_stat_t));
+    if (check_stats(f, f->shared->fs_man[H5FD_MEM_SUPER], &state))
+        TEST_ERROR
+
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Get the size of the file */
+    if ((new_file_size = h5_get_file_size(filename, fapl_new)) < 0)
+        TEST_ERROR
+
+    /* Verify the file is the correct size */
+    if (new_file_size != file_size)
+        TEST_ERROR
+
+    if (H5Pclose(fapl_new) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return (0);
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_new);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return (1);
+} /* test_mf_fs_free_batch() */
+
 /*
  *-------------------------------------------------------------------------
  * To verify that blocks are allocated from the aggregator
@@ -9078,6 +9212,7 @@ main(void)
     nerrors += test_mf_fs_alloc_free(fapl);
     nerrors += test_mf_fs_extend(fapl);
     nerrors += test_mf_fs_absorb(env_h5_drvr, fapl);
+    nerrors += test_mf_fs_free_batch(fapl);
 
     /* For old library format--interaction with meta/sdata aggregator */
     nerrors += test_mf_aggr_alloc1(env_h5_drvr, fapl);
@@ -7556,6 +7556,174 @@ test_min_dset_ohdr(void)
     CHECK(ret, FAIL, "H5Fclose");
 } /* end test_min_dset_ohdr() */
 
+/****************************************************************
+**
+**  test_file_compact():
+**    Verify H5Fcompact() moves raw data into the space freed by
+**    deleted datasets, keeps the data intact and shrinks the file.
+**
+****************************************************************/
+#define COMPACT_CHUNK   1024
+#define COMPACT_NCHUNKS 8
+static void
+test_file_compact(hbool_t new_format)
+{
+    hid_t         fid;                             /* File ID */
+    hid_t         fapl;                            /* File access property list */
+    hid_t         dcpl;                            /* Dataset creation property list */
+    hid_t         sid;                             /* Dataspace ID */
+    hid_t         did;                             /* Dataset ID */
+    hsize_t       dims    = COMPACT_CHUNK * COMPACT_NCHUNKS;
+    hsize_t       chunk   = COMPACT_CHUNK;
+    const char *  names[] = {"d0", "d1", "d2", "single", "contig"}; /* Dataset names */
+    int *         wbuf    = NULL;                  /* Data written */
+    int *         rbuf    = NULL;                  /* Data read back */
+    char          filename[FILENAME_LEN];          /* Filename to use */
+    haddr_t       eoa_before, eoa_after;           /* EOA before and after compacting */
+    hsize_t       moved;                           /* Bytes moved by one call */
+    hsize_t       total_moved = 0;                 /* Bytes moved by all calls */
+    hid_t         driver_id    = -1;               /* ID for this VFD */
+    unsigned long driver_flags = 0;                /* VFD feature flags */
+    unsigned      u, v;                            /* Local index variables */
+    herr_t        ret;                             /* Return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing H5Fcompact() with %s format\n", new_format ? "latest" : "earliest"));
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILE8, fapl, filename, sizeof filename);
+    if (new_format) {
+        ret = H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+        CHECK(ret, FAIL, "H5Pset_libver_bounds");
+    } /* end if */
+
+    /* Get the VFD feature flags */
+    driver_id = H5Pget_driver(fapl);
+    CHECK(driver_id, FAIL, "H5Pget_driver");
+    ret = H5FDdriver_query(driver_id, &driver_flags);
+    CHECK(ret, FAIL, "H5FDdriver_query");
+
+    wbuf = (int *)HDmalloc(sizeof(int) * COMPACT_CHUNK * COMPACT_NCHUNKS);
+    CHECK_PTR(wbuf, "HDmalloc");
+    rbuf = (int *)HDmalloc(sizeof(int) * COMPACT_CHUNK * COMPACT_NCHUNKS);
+    CHECK_PTR(rbuf, "HDmalloc");
+    for (u = 0; u < COMPACT_CHUNK * COMPACT_NCHUNKS; u++)
+        wbuf[u] = (int)u;
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create and write the datasets, one after the other */
+    for (u = 0; u < 5; u++) {
+        hsize_t ds_dims = (u >= 3) ? chunk : dims; /* "single" and "contig" are one chunk in size */
+
+        sid = H5Screate_simple(1, &ds_dims, NULL);
+        CHECK(sid, FAIL, "H5Screate_simple");
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+        if (u < 4) {
+            ret = H5Pset_chunk(dcpl, 1, &chunk);
+            CHECK(ret, FAIL, "H5Pset_chunk");
+        } /* end if */
+
+        did = H5Dcreate2(fid, names[u], H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(did, FAIL, "H5Dcreate2");
+        ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+        CHECK(ret, FAIL, "H5Dwrite");
+
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Pclose(dcpl);
+        CHECK(ret, FAIL, "H5Pclose");
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Delete the first two datasets, leaving holes in the file */
+    ret = H5Ldelete(fid, names[0], H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Ldelete");
+    ret = H5Ldelete(fid, names[1], H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Ldelete");
+    ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+    CHECK(ret, FAIL, "H5Fflush");
+
+    ret = H5Fget_eoa(fid, &eoa_before);
+    CHECK(ret, FAIL, "H5Fget_eoa");
+
+    /* Keep "d2" open across the compaction */
+    did = H5Dopen2(fid, names[2], H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dopen2");
+
+    /* Compact with a budget of one chunk, then the rest */
+    ret = H5Fcompact(fid, (hsize_t)(sizeof(int) * COMPACT_CHUNK), &moved);
+    CHECK(ret, FAIL, "H5Fcompact");
+    VERIFY(moved, sizeof(int) * COMPACT_CHUNK, "H5Fcompact");
+    total_moved += moved;
+    do {
+        ret = H5Fcompact(fid, 0, &moved);
+        CHECK(ret, FAIL, "H5Fcompact");
+        total_moved += moved;
+    } while (moved > 0);
+
+    /* The "d2", "single" and "contig" datasets all fit in the holes */
+    VERIFY(total_moved, sizeof(int) * (dims + 2 * chunk), "H5Fcompact");
+
+    /* The data must be unchanged, through the dataset held open too */
+    HDmemset(rbuf, 0, sizeof(int) * COMPACT_CHUNK * COMPACT_NCHUNKS);
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for (u = 0; u < COMPACT_CHUNK * COMPACT_NCHUNKS; u++)
+        if (rbuf[u] != wbuf[u]) {
+            TestErrPrintf("Data read from \"%s\" differs at %u\n", names[2], u);
+            break;
+        } /* end if */
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Fget_eoa(fid, &eoa_after);
+    CHECK(ret, FAIL, "H5Fget_eoa");
+    if (driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO)
+        if (eoa_after >= eoa_before)
+            TestErrPrintf("File didn't shrink: EOA before = %" PRIuHADDR ", after = %" PRIuHADDR "\n",
+                          eoa_before, eoa_after);
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file and check the moved data was recorded */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    for (u = 2; u < 5; u++) {
+        size_t nelmts = (u >= 3) ? COMPACT_CHUNK : COMPACT_CHUNK * COMPACT_NCHUNKS;
+
+        did = H5Dopen2(fid, names[u], H5P_DEFAULT);
+        CHECK(did, FAIL, "H5Dopen2");
+        HDmemset(rbuf, 0, sizeof(int) * COMPACT_CHUNK * COMPACT_NCHUNKS);
+        ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        for (v = 0; v < nelmts; v++)
+            if (rbuf[v] != wbuf[v]) {
+                TestErrPrintf("Data read from \"%s\" differs at %u\n", names[u], v);
+                break;
+            } /* end if */
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+
+    /* Compacting a read-only file must fail */
+    H5E_BEGIN_TRY { ret = H5Fcompact(fid, 0, &moved); }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fcompact");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_file_compact() */
+
 /****************************************************************
 **
 **  test_deprec():
@@ -7854,6 +8022,8 @@ test_file(void)
     test_libver_macros2(); /* Test the macros for library version comparison */
     test_incr_filesize();  /* Test H5Fincrement_filesize() and H5Fget_eoa() */
     test_min_dset_ohdr();  /* Test datset object header minimization */
+    test_file_compact(FALSE); /* Test H5Fcompact() */
+    test_file_compact(TRUE);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_file_ishdf5(env_h5_drvr); /* Test detecting HDF5 files correctly */
     test_deprec();                 /* Test deprecated routines */
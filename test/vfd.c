@@ -27,11 +27,13 @@
 #define MULTI_SIZE    128
 #define SPLITTER_SIZE 8 /* dimensions of a dataset */
 
-#define CORE_INCREMENT (4 * KB)
-#define CORE_PAGE_SIZE (1024 * KB)
-#define CORE_DSET_NAME "core dset"
-#define CORE_DSET_DIM1 1024
-#define CORE_DSET_DIM2 32
+#define CORE_INCREMENT      (4 * KB)
+#define CORE_PAGE_SIZE      (1024 * KB)
+#define CORE_DSET_NAME      "core dset"
+#define CORE_DSET_DIM1      1024
+#define CORE_DSET_DIM2      32
+#define CORE_MMAP_RESERVE   (64 * KB)
+#define CORE_MMAP_PAGE_SIZE (4 * KB)
 
 #define DSET1_NAME "dset1"
 #define DSET1_DIM1 1024
@@ -579,6 +581,273 @@ error:
     return -1;
 } /* end test_core() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_core_mmap
+ *
+ * Purpose:     Tests the core VFD when its memory is a mmap reservation,
+ *              including growing the file past the reservation and
+ *              incremental flushes to the backing store.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_core_mmap(void)
+{
+    hid_t   fid     = -1;   /* file ID                      */
+    hid_t   fapl_id = -1;   /* file access property list ID */
+    hid_t   fapl2   = -1;   /* file's access property list  */
+    hid_t   did     = -1;   /* dataset ID                   */
+    hid_t   sid     = -1;   /* dataspace ID                 */
+    hid_t   msid    = -1;   /* memory dataspace ID          */
+    int     fd      = -1;   /* backing store descriptor     */
+    char    filename[1024]; /* filename                     */
+    hbool_t use_mmap;       /* mmap flag                    */
+    hbool_t use_tracking;   /* write tracking flag          */
+    size_t  page_size;      /* write tracking page size     */
+    size_t  reserve_size;   /* mmap reservation size        */
+    int *   data_w = NULL;  /* data written to the dataset  */
+    int *   data_r = NULL;  /* data read from the dataset   */
+    hsize_t dims[2];        /* dataspace dimensions         */
+    hsize_t start[2];       /* hyperslab start              */
+    hsize_t count[2];       /* hyperslab count              */
+    haddr_t dset_addr;      /* address of the raw data      */
+    HDoff_t first_off;      /* file offset of first element */
+    HDoff_t last_off;       /* file offset of last element  */
+    int     value;          /* element read from disk       */
+    int     marker = -9999; /* written around the library   */
+    int     i;              /* iterator                     */
+
+    TESTING("CORE file driver with mmap reservation");
+
+    /* Get a file access property list and fix up the file name */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[1], fapl_id, filename, sizeof(filename));
+
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR;
+
+    /* Check the default and that a zero reservation is rejected */
+    if (H5Pget_core_mmap(fapl_id, &use_mmap, &reserve_size) < 0)
+        TEST_ERROR;
+    if (FALSE != use_mmap)
+        FAIL_PUTS_ERROR("mmap reservation should be off by default");
+    if (0 == reserve_size)
+        FAIL_PUTS_ERROR("mmap reservation size should never be zero");
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_core_mmap(fapl_id, TRUE, 0) >= 0)
+            FAIL_PUTS_ERROR("zero mmap reservation size was accepted");
+    }
+    H5E_END_TRY;
+
+    /* Use a reservation smaller than the dataset, so the file has to
+     * outgrow it.
+     */
+    if (H5Pset_core_mmap(fapl_id, TRUE, (size_t)CORE_MMAP_RESERVE) < 0)
+        TEST_ERROR;
+    if (H5Pget_core_mmap(fapl_id, &use_mmap, &reserve_size) < 0)
+        TEST_ERROR;
+    if (TRUE != use_mmap || CORE_MMAP_RESERVE != reserve_size)
+        FAIL_PUTS_ERROR("incorrect mmap reservation settings in fapl");
+
+    /* The mapping turns on write tracking, which can be turned off again */
+    if (H5Pget_core_write_tracking(fapl_id, &use_tracking, &page_size) < 0)
+        TEST_ERROR;
+    if (TRUE != use_tracking)
+        FAIL_PUTS_ERROR("mmap reservation should turn on write tracking");
+    if (H5Pset_core_write_tracking(fapl_id, FALSE, page_size) < 0)
+        TEST_ERROR;
+    if (H5Pget_core_write_tracking(fapl_id, &use_tracking, &page_size) < 0)
+        TEST_ERROR;
+    if (FALSE != use_tracking)
+        FAIL_PUTS_ERROR("write tracking could not be turned off with mmap reservation");
+    if (H5Pget_core_mmap(fapl_id, &use_mmap, &reserve_size) < 0)
+        TEST_ERROR;
+    if (TRUE != use_mmap || CORE_MMAP_RESERVE != reserve_size)
+        FAIL_PUTS_ERROR("turning off write tracking changed the mmap reservation");
+
+    /* Track writes in small pages, so a flush after a small change
+     * only writes a small part of the file
+     */
+    if (H5Pset_core_write_tracking(fapl_id, TRUE, (size_t)CORE_MMAP_PAGE_SIZE) < 0)
+        TEST_ERROR;
+
+    /* Allocate and initialize the buffers */
+    if (NULL == (data_w = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for input array");
+    if (NULL == (data_r = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for output array");
+    for (i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+        data_w[i] = i;
+
+    /* Create the file and write the dataset, flushing part way through */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    dims[0] = CORE_DSET_DIM1;
+    dims[1] = CORE_DSET_DIM2;
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, CORE_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+
+    /* The file outgrew the reservation, which must have been doubled */
+    if ((fapl2 = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5Pget_core_mmap(fapl2, &use_mmap, &reserve_size) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl2) < 0)
+        TEST_ERROR;
+    if (TRUE != use_mmap)
+        FAIL_PUTS_ERROR("file is not using the mmap reservation");
+    if (reserve_size < CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))
+        FAIL_PUTS_ERROR("mmap reservation did not grow with the file");
+    while (reserve_size > CORE_MMAP_RESERVE && 0 == reserve_size % 2)
+        reserve_size /= 2;
+    if (CORE_MMAP_RESERVE != reserve_size)
+        FAIL_PUTS_ERROR("mmap reservation did not grow by doubling");
+
+    /* Change the last element in the backing store behind the library's
+     * back, then change only the first element and flush.  Only the page
+     * holding the first element should be written, so the last element
+     * must still have the changed value.
+     */
+    if (HADDR_UNDEF == (dset_addr = H5Dget_offset(did)))
+        TEST_ERROR;
+    first_off = (HDoff_t)dset_addr;
+    last_off  = (HDoff_t)(dset_addr + (CORE_DSET_DIM1 * CORE_DSET_DIM2 - 1) * sizeof(int));
+    if ((fd = HDopen(filename, O_RDWR)) < 0)
+        TEST_ERROR;
+    if (HDlseek(fd, last_off, SEEK_SET) < 0 || HDwrite(fd, &marker, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+
+    start[0] = start[1] = 0;
+    count[0] = count[1] = 1;
+    data_w[0]           = marker;
+    if ((msid = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, data_w) < 0)
+        TEST_ERROR;
+    if (H5Sselect_all(sid) < 0)
+        TEST_ERROR;
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+
+    if (HDlseek(fd, first_off, SEEK_SET) < 0 || HDread(fd, &value, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+    if (marker != value)
+        FAIL_PUTS_ERROR("changed page was not flushed to the backing store");
+    if (HDlseek(fd, last_off, SEEK_SET) < 0 || HDread(fd, &value, sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+    if (marker != value)
+        FAIL_PUTS_ERROR("unchanged page was flushed to the backing store");
+
+    /* Put the last element back */
+    if (HDlseek(fd, last_off, SEEK_SET) < 0 ||
+        HDwrite(fd, &data_w[CORE_DSET_DIM1 * CORE_DSET_DIM2 - 1], sizeof(int)) != sizeof(int))
+        TEST_ERROR;
+    if (HDclose(fd) < 0)
+        TEST_ERROR;
+    fd = -1;
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file with the default driver and check the data */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+        if (data_r[i] != data_w[i])
+            FAIL_PUTS_ERROR("incorrect data read from file written with mmap reservation");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file with the core VFD, modify it and check the data */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+        data_w[i] = -i;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+        if (data_r[i] != data_w[i])
+            FAIL_PUTS_ERROR("incorrect data read after rewriting file with mmap reservation");
+
+    /* Close everything */
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    HDfree(data_w);
+    HDfree(data_r);
+
+    h5_delete_test_file(FILENAME[1], fapl_id);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Pclose(fapl2);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+
+    if (fd >= 0)
+        HDclose(fd);
+    if (data_w)
+        HDfree(data_w);
+    if (data_r)
+        HDfree(data_r);
+
+    return -1;
+} /* end test_core_mmap() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_direct
  *
@@ -3324,6 +3593,7 @@ main(void)
 
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
+    nerrors += test_core_mmap() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
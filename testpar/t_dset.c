@@ -1453,6 +1453,153 @@ dataset_readAll(void)
         HDfree(data_origin1);
 }
 
+/*
+ * Example of using the parallel HDF5 library to write and read a
+ * contiguous dataset collectively with the two-phase I/O aggregation
+ * done within the library (H5Pset_dxpl_mpio_aggregation).
+ *
+ * Each process writes every mpi_size-th column of the dataset, so that
+ * the data of all processes is interleaved in the file, except for one
+ * row in the middle which keeps the fill value.  The aggregators must
+ * therefore merge the data of all processes and preserve the unwritten
+ * row.  The dataset is then read back whole by every process, and with
+ * the same interleaved selection.
+ */
+#define TWO_PHASE_DIM0 7
+#define TWO_PHASE_DIM1 13
+#define TWO_PHASE_FILL -1
+void
+dataset_two_phase_io(void)
+{
+    hid_t                     fid, acc_tpl, dcpl, dxpl, dataset, file_dataspace, mem_dataspace;
+    hsize_t                   dims[RANK];
+    hsize_t                   start[RANK], stride[RANK], count[RANK], block[RANK];
+    hsize_t                   alignment;
+    unsigned                  num_aggregators;
+    int                       fill = TWO_PHASE_FILL;
+    int *                     wbuf = NULL, *rbuf = NULL;
+    size_t                    ncols, i, j, n;
+    int                       mpi_size, mpi_rank;
+    H5D_mpio_actual_io_mode_t io_mode;
+    herr_t                    ret;
+    const char *              filename;
+
+    filename = GetTestParameters();
+
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    dims[0] = TWO_PHASE_DIM0;
+    dims[1] = (hsize_t)(TWO_PHASE_DIM1 * mpi_size);
+    ncols   = TWO_PHASE_DIM1;
+
+    wbuf = (int *)HDmalloc(TWO_PHASE_DIM0 * ncols * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+
+    acc_tpl = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((acc_tpl >= 0), "create_faccess_plist succeeded");
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, acc_tpl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    ret = H5Pclose(acc_tpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill);
+    VRFY((ret >= 0), "H5Pset_fill_value succeeded");
+    ret = H5Pset_fill_time(dcpl, H5D_FILL_TIME_ALLOC);
+    VRFY((ret >= 0), "H5Pset_fill_time succeeded");
+
+    file_dataspace = H5Screate_simple(RANK, dims, NULL);
+    VRFY((file_dataspace >= 0), "H5Screate_simple succeeded");
+    dataset = H5Dcreate2(fid, DATASETNAME1, H5T_NATIVE_INT, file_dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dcreate2 succeeded");
+
+    /* Use two aggregators with a small alignment, so that the file domains
+     * split the rows of the dataset */
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    ret = H5Pset_dxpl_mpio_aggregation(dxpl, 2, (hsize_t)24);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio_aggregation succeeded");
+    ret = H5Pget_dxpl_mpio_aggregation(dxpl, &num_aggregators, &alignment);
+    VRFY((ret >= 0), "H5Pget_dxpl_mpio_aggregation succeeded");
+    VRFY((num_aggregators == 2 && alignment == 24), "aggregation settings retrieved");
+
+    /* Select every mpi_size-th column, starting at this process' rank, and
+     * leave the middle row unwritten */
+    start[0]  = 0;
+    start[1]  = (hsize_t)mpi_rank;
+    stride[0] = 1;
+    stride[1] = (hsize_t)mpi_size;
+    count[0]  = TWO_PHASE_DIM0;
+    count[1]  = ncols;
+    block[0]  = 1;
+    block[1]  = 1;
+    ret       = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, start, stride, count, block);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    start[0] = TWO_PHASE_DIM0 / 2;
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = dims[1];
+    ret      = H5Sselect_hyperslab(file_dataspace, H5S_SELECT_NOTB, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+
+    for (i = 0, n = 0; i < TWO_PHASE_DIM0; i++)
+        if (i != TWO_PHASE_DIM0 / 2)
+            for (j = 0; j < ncols; j++)
+                wbuf[n++] = (int)(i * 1000 + j * (size_t)mpi_size + (size_t)mpi_rank);
+
+    count[0]      = (hsize_t)n;
+    mem_dataspace = H5Screate_simple(1, count, NULL);
+    VRFY((mem_dataspace >= 0), "H5Screate_simple succeeded");
+
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_dataspace, file_dataspace, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+
+    if (facc_type == FACC_MPIO) {
+        ret = H5Pget_mpio_actual_io_mode(dxpl, &io_mode);
+        VRFY((ret >= 0), "H5Pget_mpio_actual_io_mode succeeded");
+        VRFY((io_mode == H5D_MPIO_CONTIGUOUS_COLLECTIVE), "contiguous collective I/O performed");
+    }
+
+    /* Read the whole dataset in every process */
+    ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (i = 0; i < dims[0]; i++)
+        for (j = 0; j < dims[1]; j++) {
+            int expected = (i == TWO_PHASE_DIM0 / 2) ? TWO_PHASE_FILL : (int)(i * 1000 + j);
+
+            VRFY((rbuf[i * dims[1] + j] == expected), "data read matches data written");
+        }
+
+    /* Read back this process' selection only */
+    HDmemset(rbuf, 0, n * sizeof(int));
+    ret = H5Dread(dataset, H5T_NATIVE_INT, mem_dataspace, file_dataspace, dxpl, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (i = 0; i < n; i++)
+        VRFY((rbuf[i] == wbuf[i]), "data read matches data written");
+
+    ret = H5Sclose(mem_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(file_dataspace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(dxpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+}
+
 /*
  * Part 2--Independent read/write for extendible datasets.
  */
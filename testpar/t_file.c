@@ -945,3 +945,74 @@ test_file_properties(void)
     VRFY((mpi_ret >= 0), "MPI_Info_free succeeded");
 
 } /* end test_file_properties() */
+
+/*
+ * Verify that the metadata cache sync point statistics are gathered when
+ * the metadata is flushed and that they can be reset.
+ */
+void
+test_sync_point_stats(void)
+{
+    hid_t                  fid     = H5I_INVALID_HID; /* HDF5 file ID */
+    hid_t                  fapl_id = H5I_INVALID_HID; /* File access plist */
+    hid_t                  gid     = H5I_INVALID_HID; /* Group ID */
+    H5F_sync_point_stats_t stats;                     /* Sync point statistics */
+    unsigned long long     total_bytes;               /* Bytes written by all processes */
+    unsigned long long     local_bytes;               /* Bytes written by this process */
+    const char *           filename;
+    char                   name[32];
+    int                    i;
+    herr_t                 ret;     /* Generic return value */
+    int                    mpi_ret; /* MPI return value */
+
+    filename = (const char *)GetTestParameters();
+
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl_id >= 0), "create_faccess_plist succeeded");
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+
+    /* Nothing has been flushed yet */
+    ret = H5Fget_mpi_sync_point_stats(fid, &stats);
+    VRFY((ret >= 0), "H5Fget_mpi_sync_point_stats succeeded");
+
+    /* Dirty some metadata and flush it */
+    for (i = 0; i < 16; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((gid >= 0), "H5Gcreate2 succeeded");
+        ret = H5Gclose(gid);
+        VRFY((ret >= 0), "H5Gclose succeeded");
+    }
+    ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+    VRFY((ret >= 0), "H5Fflush succeeded");
+
+    ret = H5Fget_mpi_sync_point_stats(fid, &stats);
+    VRFY((ret >= 0), "H5Fget_mpi_sync_point_stats succeeded");
+    VRFY((stats.num_sync_points > 0), "sync points were counted");
+    VRFY((stats.last_blocks <= stats.last_entries), "entries were merged into blocks");
+    VRFY((stats.last_bytes <= stats.total_bytes), "byte counts are consistent");
+    VRFY((stats.last_time >= 0.0 && stats.last_time <= stats.total_time), "timings are consistent");
+
+    /* The metadata was written by some process */
+    local_bytes = (unsigned long long)stats.total_bytes;
+    mpi_ret = MPI_Allreduce(&local_bytes, &total_bytes, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Allreduce succeeded");
+    VRFY((total_bytes > 0), "metadata bytes were written");
+
+    /* Reset the statistics */
+    ret = H5Freset_mpi_sync_point_stats(fid);
+    VRFY((ret >= 0), "H5Freset_mpi_sync_point_stats succeeded");
+    ret = H5Fget_mpi_sync_point_stats(fid, &stats);
+    VRFY((ret >= 0), "H5Fget_mpi_sync_point_stats succeeded");
+    VRFY((stats.num_sync_points == 0 && stats.total_bytes == 0 && stats.last_entries == 0),
+         "statistics were reset");
+
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+} /* end test_sync_point_stats() */
@@ -217,6 +217,108 @@ multiple_dset_write(void)
     HDfree(outme);
 }
 
+/*
+ * Example of using PHDF5 to write and read several datasets with one
+ * H5Dwrite_multi/H5Dread_multi call.  Each process writes a slab of each
+ * dataset, and the data for all datasets is transferred with a single
+ * collective I/O operation.
+ */
+void
+multiple_dset_io_collective(void)
+{
+    int                       i, n, mpi_size, mpi_rank, size, nelmts;
+    hid_t                     iof, plist, dxpl, memspace, filespace;
+    hid_t                     dsets[NDATASET];
+    hid_t                     mem_types[NDATASET], mem_spaces[NDATASET], file_spaces[NDATASET];
+    const void *              wbufs[NDATASET];
+    void *                    rbufs[NDATASET];
+    hsize_t                   chunk_origin[DIM];
+    hsize_t                   chunk_dims[DIM], file_dims[DIM];
+    hsize_t                   count[DIM] = {1, 1};
+    DATATYPE *                outme      = NULL;
+    DATATYPE *                inme       = NULL;
+    H5D_mpio_actual_io_mode_t io_mode;
+    char                      dname[100];
+    herr_t                    ret;
+    const char *              filename;
+
+    filename = (const char *)GetTestParameters();
+
+    size = get_size();
+    H5_CHECK_OVERFLOW(size, int, size_t);
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    plist = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((plist >= 0), "create_faccess_plist succeeded");
+    iof = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, plist);
+    VRFY((iof >= 0), "H5Fcreate succeeded");
+    ret = H5Pclose(plist);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* decide the hyperslab according to process number. */
+    get_slab(chunk_origin, chunk_dims, count, file_dims, size);
+
+    memspace  = H5Screate_simple(DIM, chunk_dims, NULL);
+    filespace = H5Screate_simple(DIM, file_dims, NULL);
+    ret       = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, chunk_origin, chunk_dims, count, chunk_dims);
+    VRFY((ret >= 0), "mdata hyperslab selection");
+    nelmts = (int)(chunk_dims[0] * chunk_dims[1]);
+
+    outme = HDmalloc(NDATASET * (size_t)nelmts * sizeof(DATATYPE));
+    VRFY((outme != NULL), "HDmalloc succeeded for outme");
+    inme = HDcalloc(NDATASET * (size_t)nelmts, sizeof(DATATYPE));
+    VRFY((inme != NULL), "HDcalloc succeeded for inme");
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    for (n = 0; n < NDATASET; n++) {
+        HDsprintf(dname, "dataset %d", n);
+        dsets[n] = H5Dcreate2(iof, dname, H5T_NATIVE_INT, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((dsets[n] > 0), dname);
+
+        /* calculate data to write */
+        for (i = 0; i < nelmts; i++)
+            outme[(n * nelmts) + i] = n * 1000 + mpi_rank * 100 + i;
+
+        mem_types[n]   = H5T_NATIVE_INT;
+        mem_spaces[n]  = memspace;
+        file_spaces[n] = filespace;
+        wbufs[n]       = outme + (n * nelmts);
+        rbufs[n]       = inme + (n * nelmts);
+    }
+
+    ret = H5Dwrite_multi(NDATASET, dsets, mem_types, mem_spaces, file_spaces, dxpl, wbufs);
+    VRFY((ret >= 0), "H5Dwrite_multi succeeded");
+
+    /* All datasets should have been written with one collective operation */
+    if (facc_type == FACC_MPIO) {
+        ret = H5Pget_mpio_actual_io_mode(dxpl, &io_mode);
+        VRFY((ret >= 0), "H5Pget_mpio_actual_io_mode succeeded");
+        VRFY((io_mode == H5D_MPIO_CONTIGUOUS_COLLECTIVE), "contiguous collective I/O performed");
+    }
+
+    ret = H5Dread_multi(NDATASET, dsets, mem_types, mem_spaces, file_spaces, dxpl, rbufs);
+    VRFY((ret >= 0), "H5Dread_multi succeeded");
+
+    for (i = 0; i < NDATASET * nelmts; i++)
+        VRFY((inme[i] == outme[i]), "data read matches data written");
+
+    for (n = 0; n < NDATASET; n++)
+        H5Dclose(dsets[n]);
+    H5Pclose(dxpl);
+    H5Sclose(filespace);
+    H5Sclose(memspace);
+    H5Fclose(iof);
+
+    HDfree(inme);
+    HDfree(outme);
+}
+
 /* Example of using PHDF5 to create, write, and read compact dataset.
  *
  * Changes:    Updated function to use a dynamically calculated size,
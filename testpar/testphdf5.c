@@ -352,12 +352,14 @@ main(int argc, char **argv)
 #endif
 
     AddTest("props", test_file_properties, NULL, "Coll Metadata file property settings", PARATESTFILE);
+    AddTest("syncstats", test_sync_point_stats, NULL, "metadata cache sync point statistics", PARATESTFILE);
 
     AddTest("idsetw", dataset_writeInd, NULL, "dataset independent write", PARATESTFILE);
     AddTest("idsetr", dataset_readInd, NULL, "dataset independent read", PARATESTFILE);
 
     AddTest("cdsetw", dataset_writeAll, NULL, "dataset collective write", PARATESTFILE);
     AddTest("cdsetr", dataset_readAll, NULL, "dataset collective read", PARATESTFILE);
+    AddTest("tphase", dataset_two_phase_io, NULL, "dataset two-phase collective I/O", PARATESTFILE);
 
     AddTest("eidsetw", extend_writeInd, NULL, "extendible dataset independent write", PARATESTFILE);
     AddTest("eidsetr", extend_readInd, NULL, "extendible dataset independent read", PARATESTFILE);
@@ -379,6 +381,8 @@ main(int argc, char **argv)
     ndsets_params.name  = PARATESTFILE;
     ndsets_params.count = ndatasets;
     AddTest("ndsetw", multiple_dset_write, NULL, "multiple datasets write", &ndsets_params);
+    AddTest("ndsetio", multiple_dset_io_collective, NULL, "multiple datasets collective I/O",
+            PARATESTFILE);
 
     ngroups_params.name  = PARATESTFILE;
     ngroups_params.count = ngroups;
@@ -238,7 +238,9 @@ void test_plist_ed(void);
 void external_links(void);
 void zero_dim_dset(void);
 void test_file_properties(void);
+void test_sync_point_stats(void);
 void multiple_dset_write(void);
+void multiple_dset_io_collective(void);
 void multiple_group_write(void);
 void multiple_group_read(void);
 void collective_group_write_independent_group_read(void);
@@ -255,6 +257,7 @@ void extend_writeInd2(void);
 void extend_writeAll(void);
 void dataset_readInd(void);
 void dataset_readAll(void);
+void dataset_two_phase_io(void);
 void extend_readInd(void);
 void extend_readAll(void);
 void none_selection_chunk(void);